@@ -45,6 +45,12 @@
 #define PIN_RST  A11  // RST  — reset / trigger (ADS1115 AIN3)
 #endif
 
+// ADS1115 ALERT/RDY → GPIO (open-drain, internal pull-up used). -1 = not
+// wired: the driver times conversions instead of waiting for the pin.
+#ifndef PIN_ADS_RDY
+#define PIN_ADS_RDY -1
+#endif
+
 // Gate threshold (ADC counts, 10-bit): ~1.5V after scaling
 #ifndef CV_GATE_THRESH
 #define CV_GATE_THRESH 465
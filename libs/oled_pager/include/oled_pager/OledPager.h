@@ -0,0 +1,60 @@
+#pragma once
+#include <Arduino.h>
+#include <Wire.h>
+#include <Adafruit_SSD1306.h>
+
+namespace oled_pager {
+
+// Non-blocking SSD1306 flush for Teensy 4.x (LPI2C1 / Wire, pins 18-19).
+//
+// Draw into the Adafruit framebuffer as usual, then call poll() from loop()
+// instead of oled.display(). poll() compares each 128-byte page against a
+// shadow of what the panel already shows; the next changed page is copied
+// into a command queue and handed to the LPI2C transmit-FIFO interrupt,
+// which feeds the bus while loop() carries on. One page is in flight at a
+// time, so a poll() costs a few microseconds whether or not it starts one.
+//
+// After begin() the pager owns LPI2C1: nothing else may use Wire (including
+// oled.display()) while busy().
+class OledPager {
+public:
+  static const uint8_t MAX_WIDTH = 128;
+  static const uint8_t MAX_PAGES = 8;
+
+  explicit OledPager(Adafruit_SSD1306& oled, uint8_t addr = 0x3C)
+    : oled_(oled), addr_(addr) {}
+
+  // Call after oled.begin(). Sets the bus clock and installs the IRQ handler.
+  void begin(TwoWire& wire = Wire, uint32_t hz = 400000, uint8_t irqPriority = 128);
+
+  bool poll();                          // start the next changed page if idle; true if one is in flight
+  bool busy() const { return busy_; }
+  void invalidate();                    // resend every page (panel reset, glitch)
+  uint8_t pendingPages() const;         // pages whose framebuffer differs from the panel
+
+  // Stats (since last reset)
+  uint32_t pagesSent() const { return pagesSent_; }
+  uint32_t busErrors() const { return busErrors_; }
+  uint32_t maxPageUs() const { return maxPageUs_; }   // start-to-stop time of one page
+  void statsReset() { pagesSent_ = 0; busErrors_ = 0; maxPageUs_ = 0; }
+
+private:
+  static void isr();
+  void onIrq();
+  void startPage(uint8_t page);
+
+  Adafruit_SSD1306& oled_;
+  uint8_t  addr_;
+  uint8_t  pages_ = 0, width_ = 0;
+  uint8_t  nextPage_ = 0;                        // round-robin scan start
+  uint8_t  shadow_[MAX_PAGES * MAX_WIDTH];       // what the panel shows
+  bool     shadowValid_[MAX_PAGES];
+  uint16_t tx_[MAX_WIDTH + 12];                  // LPI2C MTDR words for one page
+  volatile uint16_t txLen_ = 0, txPos_ = 0;
+  volatile bool busy_ = false;
+  volatile int8_t inFlight_ = -1;
+  uint32_t startUs_ = 0;
+  volatile uint32_t pagesSent_ = 0, busErrors_ = 0, maxPageUs_ = 0;
+};
+
+} // namespace oled_pager
@@ -0,0 +1,64 @@
+#pragma once
+#include <Arduino.h>
+#include <SPI.h>
+#include <EventResponder.h>
+#include <Adafruit_SSD1306.h>
+
+namespace oled_pager {
+
+// Non-blocking SSD1306 flush over SPI with DMA, Teensy 4.x.
+//
+// Same model as OledPager: draw into the Adafruit framebuffer, then call
+// poll() from loop() instead of oled.display(). Each 128-byte page is compared
+// against a shadow of the panel; the next changed page gets its 6-byte
+// address window written directly (D/C low, a few microseconds), then its
+// data goes out by DMA (D/C high) while loop() carries on. One page is in
+// flight at a time and the SPI transaction is held only for that page, so
+// interrupts registered with SPI.usingInterrupt() are masked for ~150 µs at
+// a time rather than for a whole frame.
+//
+// After begin() nothing else may draw to the panel with oled.display().
+// Other devices on the same SPI bus are fine between pages.
+class OledSpiPager {
+public:
+  static const uint8_t MAX_WIDTH = 128;
+  static const uint8_t MAX_PAGES = 8;
+
+  OledSpiPager(Adafruit_SSD1306& oled, uint8_t csPin, uint8_t dcPin)
+    : oled_(oled), cs_(csPin), dc_(dcPin) {}
+
+  // Call after oled.begin().
+  void begin(SPIClass& spi = SPI, uint32_t hz = 8000000);
+
+  bool poll();                          // finish / start pages; true while one is in flight
+  bool busy() const { return inFlight_ >= 0; }
+  void invalidate();                    // resend every page
+  uint8_t pendingPages() const;         // pages whose framebuffer differs from the panel
+
+  // Stats (since last reset)
+  uint32_t pagesSent() const { return pagesSent_; }
+  uint32_t maxPageUs() const { return maxPageUs_; }   // window write to DMA done
+  void statsReset() { pagesSent_ = 0; maxPageUs_ = 0; }
+
+private:
+  static void onDmaDone(EventResponderRef ev);
+  void startPage(uint8_t page);
+  void finishPage();
+
+  Adafruit_SSD1306& oled_;
+  uint8_t  cs_, dc_;
+  SPIClass* spi_ = nullptr;
+  SPISettings settings_;
+  EventResponder event_;
+  uint8_t  pages_ = 0, width_ = 0;
+  uint8_t  nextPage_ = 0;                        // round-robin scan start
+  uint8_t  shadow_[MAX_PAGES * MAX_WIDTH];       // what the panel shows; DMA source
+  bool     shadowValid_[MAX_PAGES];
+  int8_t   inFlight_ = -1;
+  volatile bool dmaDone_ = false;
+  volatile uint32_t doneUs_ = 0;
+  uint32_t startUs_ = 0;
+  uint32_t pagesSent_ = 0, maxPageUs_ = 0;
+};
+
+} // namespace oled_pager
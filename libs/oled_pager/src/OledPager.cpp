@@ -0,0 +1,126 @@
+#include "oled_pager/OledPager.h"
+#include <string.h>
+
+namespace oled_pager {
+
+// LPI2C1 is the peripheral behind Wire on Teensy 4.x. Only one pager can own
+// it, so the IRQ trampoline keeps a single instance pointer.
+static IMXRT_LPI2C_t* const kPort = &IMXRT_LPI2C1;
+static OledPager* s_owner = nullptr;
+
+static const uint32_t kErrFlags = LPI2C_MSR_NDF | LPI2C_MSR_ALF | LPI2C_MSR_FEF | LPI2C_MSR_PLTF;
+static const uint32_t kErrIrqs  = LPI2C_MIER_NDIE | LPI2C_MIER_ALIE | LPI2C_MIER_FEIE | LPI2C_MIER_PLTIE;
+
+// SSD1306 control bytes
+static const uint8_t kCtrlCmd  = 0x00;
+static const uint8_t kCtrlData = 0x40;
+
+void OledPager::begin(TwoWire& wire, uint32_t hz, uint8_t irqPriority) {
+  // Adafruit_SSD1306 drops the clock back to its "after" rate when display()
+  // returns, so set the rate the pager runs at here.
+  wire.setClock(hz);
+  width_ = oled_.width() > MAX_WIDTH ? MAX_WIDTH : oled_.width();
+  pages_ = oled_.height() / 8; if (pages_ > MAX_PAGES) pages_ = MAX_PAGES;
+  invalidate();
+  s_owner = this;
+  kPort->MIER = 0;
+  attachInterruptVector(IRQ_LPI2C1, isr);
+  NVIC_SET_PRIORITY(IRQ_LPI2C1, irqPriority);
+  NVIC_ENABLE_IRQ(IRQ_LPI2C1);
+}
+
+void OledPager::invalidate() {
+  for (uint8_t p = 0; p < MAX_PAGES; p++) shadowValid_[p] = false;
+}
+
+uint8_t OledPager::pendingPages() const {
+  const uint8_t* fb = oled_.getBuffer();
+  uint8_t n = 0;
+  for (uint8_t p = 0; p < pages_; p++) {
+    if (!shadowValid_[p] || memcmp(fb + p * width_, shadow_ + p * width_, width_) != 0) n++;
+  }
+  return n;
+}
+
+bool OledPager::poll() {
+  if (busy_ || !pages_) return busy_;
+  const uint8_t* fb = oled_.getBuffer();
+  // Round-robin so a page that changes every frame can't starve the others
+  for (uint8_t i = 0; i < pages_; i++) {
+    uint8_t p = (uint8_t)((nextPage_ + i) % pages_);
+    const uint8_t* src = fb + p * width_;
+    if (shadowValid_[p] && memcmp(src, shadow_ + p * width_, width_) == 0) continue;
+    nextPage_ = (uint8_t)((p + 1) % pages_);
+    startPage(p);
+    return true;
+  }
+  return false;
+}
+
+// One page = set column/page window (command stream), repeated START,
+// then the data stream. The page is snapshotted here so drawing can continue
+// while it goes out.
+void OledPager::startPage(uint8_t page) {
+  const uint8_t* src = oled_.getBuffer() + page * width_;
+  memcpy(shadow_ + page * width_, src, width_);
+  shadowValid_[page] = true;
+
+  const uint16_t start = (uint16_t)(LPI2C_MTDR_CMD_START | (addr_ << 1));
+  uint16_t n = 0;
+  tx_[n++] = start;
+  tx_[n++] = LPI2C_MTDR_CMD_TRANSMIT | kCtrlCmd;
+  tx_[n++] = LPI2C_MTDR_CMD_TRANSMIT | SSD1306_COLUMNADDR;
+  tx_[n++] = LPI2C_MTDR_CMD_TRANSMIT | 0;
+  tx_[n++] = LPI2C_MTDR_CMD_TRANSMIT | (uint8_t)(width_ - 1);
+  tx_[n++] = LPI2C_MTDR_CMD_TRANSMIT | SSD1306_PAGEADDR;
+  tx_[n++] = LPI2C_MTDR_CMD_TRANSMIT | page;
+  tx_[n++] = LPI2C_MTDR_CMD_TRANSMIT | page;
+  tx_[n++] = start;
+  tx_[n++] = LPI2C_MTDR_CMD_TRANSMIT | kCtrlData;
+  for (uint8_t x = 0; x < width_; x++) tx_[n++] = LPI2C_MTDR_CMD_TRANSMIT | src[x];
+  tx_[n++] = LPI2C_MTDR_CMD_STOP;
+
+  txLen_ = n; txPos_ = 0;
+  inFlight_ = (int8_t)page;
+  busy_ = true;
+  startUs_ = micros();
+  kPort->MSR = kErrFlags | LPI2C_MSR_SDF;   // clear stale status
+  kPort->MIER = LPI2C_MIER_TDIE | kErrIrqs; // TDF is already set: the IRQ fills the FIFO
+}
+
+void OledPager::isr() { if (s_owner) s_owner->onIrq(); }
+
+void OledPager::onIrq() {
+  uint32_t msr = kPort->MSR;
+  if (msr & kErrFlags) {
+    // NACK / arbitration / FIFO / pin-low: drop the page, resend it later
+    kPort->MIER = 0;
+    kPort->MCR |= LPI2C_MCR_RTF | LPI2C_MCR_RRF;
+    kPort->MSR = kErrFlags | LPI2C_MSR_SDF;
+    if (!(msr & LPI2C_MSR_ALF)) kPort->MTDR = LPI2C_MTDR_CMD_STOP;
+    if (inFlight_ >= 0) shadowValid_[inFlight_] = false;
+    inFlight_ = -1;
+    busErrors_++;
+    busy_ = false;
+    return;
+  }
+  if (txPos_ >= txLen_) {
+    if (msr & LPI2C_MSR_SDF) {
+      kPort->MSR = LPI2C_MSR_SDF;
+      kPort->MIER = 0;
+      uint32_t us = micros() - startUs_;
+      if (us > maxPageUs_) maxPageUs_ = us;
+      pagesSent_++;
+      inFlight_ = -1;
+      busy_ = false;
+    }
+    return;
+  }
+  uint16_t pos = txPos_;
+  while (pos < txLen_ && (kPort->MFSR & 0x07) < 4) kPort->MTDR = tx_[pos++];
+  txPos_ = pos;
+  // Everything queued: stop asking for FIFO space, wait for the STOP instead
+  if (pos >= txLen_) kPort->MIER = LPI2C_MIER_SDIE | kErrIrqs;
+}
+
+} // namespace oled_pager
@@ -0,0 +1,93 @@
+#include "oled_pager/OledSpiPager.h"
+#include <string.h>
+
+namespace oled_pager {
+
+// The DMA completion callback carries no context beyond the EventResponder,
+// so keep the (single) owner here.
+static OledSpiPager* s_spiOwner = nullptr;
+
+void OledSpiPager::begin(SPIClass& spi, uint32_t hz) {
+  spi_ = &spi;
+  settings_ = SPISettings(hz, MSBFIRST, SPI_MODE0);
+  width_ = oled_.width() > MAX_WIDTH ? MAX_WIDTH : oled_.width();
+  pages_ = oled_.height() / 8; if (pages_ > MAX_PAGES) pages_ = MAX_PAGES;
+  pinMode(cs_, OUTPUT); digitalWriteFast(cs_, HIGH);
+  pinMode(dc_, OUTPUT);
+  invalidate();
+  s_spiOwner = this;
+  event_.attachImmediate(onDmaDone);   // runs in the DMA ISR
+}
+
+void OledSpiPager::invalidate() {
+  for (uint8_t p = 0; p < MAX_PAGES; p++) shadowValid_[p] = false;
+}
+
+uint8_t OledSpiPager::pendingPages() const {
+  const uint8_t* fb = oled_.getBuffer();
+  uint8_t n = 0;
+  for (uint8_t p = 0; p < pages_; p++) {
+    if (!shadowValid_[p] || memcmp(fb + p * width_, shadow_ + p * width_, width_) != 0) n++;
+  }
+  return n;
+}
+
+// Release the bus right here rather than at the next poll(): loop() may be
+// busy for a while, and the transaction masks usingInterrupt() IRQs.
+void OledSpiPager::onDmaDone(EventResponderRef) {
+  OledSpiPager* self = s_spiOwner;
+  if (!self) return;
+  digitalWriteFast(self->cs_, HIGH);
+  self->spi_->endTransaction();
+  self->doneUs_ = micros();
+  self->dmaDone_ = true;
+}
+
+bool OledSpiPager::poll() {
+  if (inFlight_ >= 0) {
+    if (!dmaDone_) return true;
+    finishPage();
+  }
+  if (!pages_) return false;
+  const uint8_t* fb = oled_.getBuffer();
+  // Round-robin so a page that changes every frame can't starve the others
+  for (uint8_t i = 0; i < pages_; i++) {
+    uint8_t p = (uint8_t)((nextPage_ + i) % pages_);
+    if (shadowValid_[p] && memcmp(fb + p * width_, shadow_ + p * width_, width_) == 0) continue;
+    nextPage_ = (uint8_t)((p + 1) % pages_);
+    startPage(p);
+    return true;
+  }
+  return false;
+}
+
+// Snapshot the page into the shadow (which is also the DMA source, so drawing
+// can continue), write the address window, then DMA the data.
+void OledSpiPager::startPage(uint8_t page) {
+  uint8_t* src = shadow_ + page * width_;
+  memcpy(src, oled_.getBuffer() + page * width_, width_);
+  shadowValid_[page] = true;
+
+  const uint8_t window[6] = {
+    SSD1306_COLUMNADDR, 0, (uint8_t)(width_ - 1),
+    SSD1306_PAGEADDR, page, page
+  };
+  startUs_ = micros();
+  spi_->beginTransaction(settings_);
+  digitalWriteFast(cs_, LOW);
+  digitalWriteFast(dc_, LOW);
+  for (uint8_t i = 0; i < sizeof(window); i++) spi_->transfer(window[i]);
+  digitalWriteFast(dc_, HIGH);
+  dmaDone_ = false;
+  inFlight_ = (int8_t)page;
+  spi_->transfer(src, nullptr, width_, event_);
+}
+
+void OledSpiPager::finishPage() {
+  uint32_t us = doneUs_ - startUs_;
+  if (us > maxPageUs_) maxPageUs_ = us;
+  pagesSent_++;
+  inFlight_ = -1;
+}
+
+} // namespace oled_pager
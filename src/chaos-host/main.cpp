@@ -0,0 +1,456 @@
+// chaos-host: offline tools for the teensy-chaos algorithms, built natively
+// (pio run -e chaos-host) from the same chaos_algos.h the firmware runs.
+//
+//   chaos-host list
+//   chaos-host render <algo> [-c CHAOS] [-r RATE] [-k CHAR] [-t SEC] [-o OS]
+//                            [-u HZ] -f out.wav|out.csv
+//   chaos-host sweep  <algo|all> [-n GRID] [-k CHAR] [-t SEC] [-o OS] [-f cells.csv]
+//   chaos-host bench  [algo|all] [-t SEC]
+//
+// render runs the firmware's block path (renderBlock, output scaling, soft
+// clip, DC blocker, int16) and writes a 44.1 kHz stereo WAV, or the raw X/Y
+// and final L/R per sample as CSV. -u forces the line-in input with a
+// half-scale sine.
+//
+// sweep runs a CHAOS × RATE grid at a fixed CHAR. The grid covers the
+// metadata CHAOS range widened by a quarter on each side and RATE from half
+// rateMin to twice rateMax (what the CLK/ASGN CVs can reach). Each cell gets
+// a warm-up, then the largest Lyapunov exponent by twin trajectories
+// (Benettin: a copy perturbed by d0, renormalised every few samples), the
+// output range and guard resets. Cells are classed diverged (non-finite
+// output or a guard reset), fixed point (output span ~0), periodic (λ ≤
+// kLyapChaotic) or chaotic. The result is an ASCII map, an optional per-cell
+// CSV, and the widest safe CHAOS/RATE box as metadata lines to paste.
+// λ is per unit of RATE: per time unit for flows, per iterate for maps.
+//
+// bench times every algorithm's full block path at fixed x1 and adaptive
+// oversampling: ns per output sample and, on x86, TSC cycles per sample.
+// On-target cycles come from the firmware's [chaos] report.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <chrono>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HOST_TSC 1
+#endif
+#include "chaos_algos.h"
+
+static constexpr float kSampleRate   = 44100.0f;
+static constexpr int   kLyapChunk    = 4;       // samples between renormalisations
+static constexpr float kLyapChaotic  = 0.01f;   // λ above this counts as chaos
+static constexpr float kFixedSpan    = 1.0e-3f; // relative output span of a fixed point
+static constexpr float kBlowUp       = 1.0e6f;
+
+// Keeps the optimiser from dropping work whose result is otherwise unused
+static inline void benchBarrier(const void* p) { __asm__ volatile("" : : "r"(p) : "memory"); }
+
+// ─── Algorithm table ──────────────────────────────────────────────────────────
+enum CellClass : uint8_t { CELL_DIVERGED, CELL_FIXED, CELL_PERIODIC, CELL_CHAOTIC };
+static const char kCellChar[] = {'X', '.', '~', '#'};
+static const char* const kCellName[] = {"diverged", "fixed", "periodic", "chaotic"};
+
+struct CellResult {
+    float lyap;
+    float xMin, xMax, yMin, yMax;
+    uint32_t resets;
+    CellClass cls;
+};
+
+struct Opts {
+    float chaos = NAN, rate = NAN, charV = NAN;
+    float seconds = 1.0f;
+    int   grid = 16;
+    uint8_t os = 1;
+    float forceHz = 0.0f;
+    const char* file = nullptr;
+};
+
+struct Entry {
+    ChaosBase* (*make)();
+    CellResult (*cell)(const ChaosParams&, const Opts&);
+};
+
+// One grid cell on a fresh instance of A
+template <class A>
+static CellResult runCell(const ChaosParams& p, const Opts& o) {
+    static float zeros[AUDIO_BLOCK_SAMPLES];
+    float xs[AUDIO_BLOCK_SAMPLES], ys[AUDIO_BLOCK_SAMPLES];
+    CvTap cv;
+    CellResult r = {0.0f, INFINITY, -INFINITY, INFINITY, -INFINITY, 0, CELL_CHAOTIC};
+    A a;
+    a.init();
+    a.post(p);
+    const int total = (int)(o.seconds * kSampleRate);
+    const int warm  = total / 4;
+    bool bad = false;
+    for (int i = 0; i < warm && !bad; i += AUDIO_BLOCK_SAMPLES) {
+        cv.n = 0;
+        a.renderBlock(zeros, xs, ys, AUDIO_BLOCK_SAMPLES, o.os, cv);
+        bad = !isfinite(xs[AUDIO_BLOCK_SAMPLES - 1]);
+    }
+    uint32_t resets0 = a.guardResets;
+
+    // Twin: same object, state nudged by d0 along the diagonal
+    A b = a;
+    float* sa = a.state();
+    float* sb = b.state();
+    float norm = 0.0f;
+    for (int k = 0; k < A::kDim; k++) norm += sa[k] * sa[k];
+    const float d0 = 1.0e-4f * fmaxf(1.0f, sqrtf(norm / A::kDim));
+    for (int k = 0; k < A::kDim; k++) sb[k] = sa[k] + d0 / sqrtf((float)A::kDim);
+
+    double logSum = 0.0, tSum = 0.0;
+    float xb[kLyapChunk], yb[kLyapChunk];
+    for (int i = 0; i < total - warm && !bad; i += kLyapChunk) {
+        cv.n = 0;
+        a.renderBlock(zeros, xs, ys, kLyapChunk, o.os, cv);
+        cv.n = 0;
+        b.renderBlock(zeros, xb, yb, kLyapChunk, o.os, cv);
+        for (int j = 0; j < kLyapChunk; j++) {
+            if (!isfinite(xs[j]) || !isfinite(ys[j]) || fabsf(xs[j]) > kBlowUp || fabsf(ys[j]) > kBlowUp) bad = true;
+            r.xMin = fminf(r.xMin, xs[j]); r.xMax = fmaxf(r.xMax, xs[j]);
+            r.yMin = fminf(r.yMin, ys[j]); r.yMax = fmaxf(r.yMax, ys[j]);
+        }
+        float d2 = 0.0f;
+        for (int k = 0; k < A::kDim; k++) { float e = sb[k] - sa[k]; d2 += e * e; }
+        float d = sqrtf(d2);
+        if (!(d > 1.0e-30f)) d = 1.0e-30f;          // twins merged: strong contraction
+        logSum += log((double)d / d0);
+        tSum   += (double)kLyapChunk * a.stepSize();
+        const float k0 = d0 / d;
+        for (int k = 0; k < A::kDim; k++) sb[k] = sa[k] + (sb[k] - sa[k]) * k0;
+    }
+    r.resets = a.guardResets - resets0;
+    r.lyap = tSum > 0.0 ? (float)(logSum / tSum) : 0.0f;
+    if (bad || r.resets) { r.cls = CELL_DIVERGED; return r; }
+    float spanX = r.xMax - r.xMin, spanY = r.yMax - r.yMin;
+    float mag = 1.0f + fmaxf(fmaxf(fabsf(r.xMin), fabsf(r.xMax)), fmaxf(fabsf(r.yMin), fabsf(r.yMax)));
+    if (spanX < kFixedSpan * mag && spanY < kFixedSpan * mag) r.cls = CELL_FIXED;
+    else r.cls = (r.lyap > kLyapChaotic) ? CELL_CHAOTIC : CELL_PERIODIC;
+    return r;
+}
+
+template <class A> static ChaosBase* make() { return new A(); }
+#define ALGO(T) { make<T>, runCell<T> }
+
+// Registry order as in the firmware
+static const Entry kAlgos[] = {
+    ALGO(ChaosRossler), ALGO(ChaosVanDerPol), ALGO(ChaosLorenz), ALGO(ChaosChua),
+    ALGO(ChaosDuffing), ALGO(ChaosCoupledRossler), ALGO(ChaosPolyRossler),
+    ALGO(ChaosThomas), ALGO(ChaosAizawa), ALGO(ChaosChen), ALGO(ChaosHalvorsen), ALGO(ChaosSprott),
+    ALGO(ChaosLogistic), ALGO(ChaosHenon), ALGO(ChaosIkeda), ALGO(ChaosStandard), ALGO(ChaosMandelbrot),
+};
+static constexpr int kNumAlgos = sizeof(kAlgos) / sizeof(kAlgos[0]);
+static ChaosBase* gProto[kNumAlgos];         // metadata, one instance each
+
+// Names match case-insensitively with spaces ignored ("vanderpol", "SPROTT A")
+static bool nameMatch(const char* name, const char* arg) {
+    for (;;) {
+        while (*name == ' ') name++;
+        while (*arg == ' ' || *arg == '-' || *arg == '_') arg++;
+        if (!*name || !*arg) return !*name && !*arg;
+        if (tolower((unsigned char)*name++) != tolower((unsigned char)*arg++)) return false;
+    }
+}
+
+static int findAlgo(const char* arg) {
+    for (int i = 0; i < kNumAlgos; i++) if (nameMatch(gProto[i]->name, arg)) return i;
+    return -1;
+}
+
+// ─── WAV / CSV output ─────────────────────────────────────────────────────────
+static void put16(FILE* f, uint16_t v) { fputc(v & 0xff, f); fputc(v >> 8, f); }
+static void put32(FILE* f, uint32_t v) { put16(f, v & 0xffff); put16(f, v >> 16); }
+
+static void wavHeader(FILE* f, uint32_t frames) {
+    const uint32_t bytes = frames * 4;
+    fwrite("RIFF", 1, 4, f); put32(f, 36 + bytes); fwrite("WAVE", 1, 4, f);
+    fwrite("fmt ", 1, 4, f); put32(f, 16); put16(f, 1); put16(f, 2);
+    put32(f, (uint32_t)kSampleRate); put32(f, (uint32_t)kSampleRate * 4); put16(f, 4); put16(f, 16);
+    fwrite("data", 1, 4, f); put32(f, bytes);
+}
+
+static bool endsWith(const char* s, const char* suf) {
+    size_t n = strlen(s), m = strlen(suf);
+    return n >= m && strcmp(s + n - m, suf) == 0;
+}
+
+// ─── Commands ─────────────────────────────────────────────────────────────────
+static float midOr(float v, float lo, float hi) { return isnan(v) ? 0.5f * (lo + hi) : v; }
+
+// v as a C++ float literal ("22.0f", "0.0005f")
+static const char* lit(char* buf, size_t n, float v) {
+    int k = snprintf(buf, n, "%.4g", v);
+    if (!strpbrk(buf, ".e") && k + 3 < (int)n) strcat(buf, ".0");
+    strncat(buf, "f", n - strlen(buf) - 1);
+    return buf;
+}
+
+static int cmdList() {
+    printf("%-12s %-5s %-22s %-22s %-22s\n", "algo", "integ", "CHAOS", "RATE", "CHAR");
+    for (int i = 0; i < kNumAlgos; i++) {
+        ChaosBase* a = gProto[i];
+        char c[32], r[32], k[32];
+        snprintf(c, sizeof(c), "%s %g..%g", a->chaosLabel, a->chaosMin, a->chaosMax);
+        snprintf(r, sizeof(r), "dt %g..%g", a->rateMin, a->rateMax);
+        snprintf(k, sizeof(k), "%s %g..%g", a->charLabel, a->charMin, a->charMax);
+        printf("%-12s %-5s %-22s %-22s %-22s%s%s\n", a->name, a->integName, c, r, k,
+               a->autoNorm ? " norm" : "", a->forceGain != 0.0f ? " forced" : "");
+    }
+    return 0;
+}
+
+static int cmdRender(int idx, const Opts& o) {
+    if (!o.file) { fprintf(stderr, "render: -f out.wav|out.csv required\n"); return 1; }
+    ChaosBase* a = kAlgos[idx].make();
+    ChaosParams p = { midOr(o.chaos, a->chaosMin, a->chaosMax), midOr(o.rate, a->rateMin, a->rateMax),
+                      midOr(o.charV, a->charMin, a->charMax) };
+    a->init();
+    a->post(p);
+    const bool csv = endsWith(o.file, ".csv");
+    FILE* f = fopen(o.file, "wb");
+    if (!f) { perror(o.file); return 1; }
+    // Whole firmware blocks, then one partial block for the remainder
+    const uint32_t total = (uint32_t)(o.seconds * kSampleRate + 0.5f);
+    if (csv) fprintf(f, "n,x,y,left,right\n");
+    else wavHeader(f, total);
+
+    DcBlocker dcL, dcR;
+    CvTap cv;
+    float us[AUDIO_BLOCK_SAMPLES], xs[AUDIO_BLOCK_SAMPLES], ys[AUDIO_BLOCK_SAMPLES];
+    float rawX[AUDIO_BLOCK_SAMPLES], rawY[AUDIO_BLOCK_SAMPLES];
+    int16_t outL[AUDIO_BLOCK_SAMPLES], outR[AUDIO_BLOCK_SAMPLES];
+    uint32_t n = 0, clipped = 0;
+    while (n < total) {
+        const int bn = (total - n < AUDIO_BLOCK_SAMPLES) ? (int)(total - n) : AUDIO_BLOCK_SAMPLES;
+        for (int i = 0; i < bn; i++) {
+            float ph = 6.2831853f * o.forceHz * (float)(n + i) / kSampleRate;
+            us[i] = o.forceHz > 0.0f ? 0.5f * a->forceGain * sinf(ph) : 0.0f;
+        }
+        cv.n = 0;
+        a->renderBlock(us, xs, ys, bn, o.os, cv);
+        memcpy(rawX, xs, bn * sizeof(float)); memcpy(rawY, ys, bn * sizeof(float));
+        OutputScale sc = outputScale(*a, xs, ys, bn);
+        softClipBlock(xs, bn, sc.gL, sc.offL);
+        softClipBlock(ys, bn, sc.gR, sc.offR);
+        dcL.process(xs, bn);
+        dcR.process(ys, bn);
+        floatToInt16Block(xs, outL, bn, 32000.0f);
+        floatToInt16Block(ys, outR, bn, 32000.0f);
+        for (int i = 0; i < bn; i++, n++) {
+            if (outL[i] == 32767 || outL[i] == -32767 || outR[i] == 32767 || outR[i] == -32767) clipped++;
+            if (csv) fprintf(f, "%u,%.6g,%.6g,%.6g,%.6g\n", n, rawX[i], rawY[i], xs[i], ys[i]);
+            else { put16(f, (uint16_t)outL[i]); put16(f, (uint16_t)outR[i]); }
+        }
+    }
+    fclose(f);
+    printf("%s: %s c=%g r=%g k=%g os=%u, %u samples, %u clipped, %u guard resets -> %s\n",
+           a->name, a->integName, p.chaos, p.rate, p.charV, (unsigned)o.os, n, clipped,
+           (unsigned)a->guardResets, o.file);
+    delete a;
+    return 0;
+}
+
+static void sweepOne(int idx, const Opts& o, FILE* csv) {
+    const ChaosBase* m = gProto[idx];
+    const int G = o.grid;
+    const float span = m->chaosMax - m->chaosMin;
+    const float c0 = m->chaosMin - 0.25f * span, c1 = m->chaosMax + 0.25f * span;
+    const float r0 = 0.5f * m->rateMin, r1 = 2.0f * m->rateMax;
+    const float charV = midOr(o.charV, m->charMin, m->charMax);
+    float cs[64], rs[64];
+    for (int i = 0; i < G; i++) {
+        float t = (G > 1) ? (float)i / (G - 1) : 0.5f;
+        cs[i] = c0 + t * (c1 - c0);
+        rs[i] = r0 * powf(r1 / r0, t);               // geometric, like the RATE ramp
+    }
+    static CellResult res[64][64];                   // [rate][chaos]
+    for (int j = 0; j < G; j++)
+        for (int i = 0; i < G; i++) {
+            res[j][i] = kAlgos[idx].cell({cs[i], rs[j], charV}, o);
+            const CellResult& r = res[j][i];
+            if (csv) fprintf(csv, "%s,%g,%g,%g,%.5f,%s,%g,%g,%g,%g,%u\n", m->name, cs[i], rs[j], charV,
+                             r.lyap, kCellName[r.cls], r.xMin, r.xMax, r.yMin, r.yMax, r.resets);
+        }
+
+    printf("\n%s  (%s, %s = %g, os %u, %.2f s/cell)   # chaotic  ~ periodic  . fixed  X diverged\n",
+           m->name, m->integName, m->charLabel, charV, (unsigned)o.os, o.seconds);
+    printf("  %-9s %s → %g .. %g  ('|' = metadata range)\n", "dt ↓", m->chaosLabel, c0, c1);
+    for (int j = G - 1; j >= 0; j--) {
+        printf("  %-9.4g ", rs[j]);
+        for (int i = 0; i < G; i++) {
+            bool edge = (i > 0 && cs[i - 1] < m->chaosMin && cs[i] >= m->chaosMin) ||
+                        (i > 0 && cs[i - 1] <= m->chaosMax && cs[i] > m->chaosMax);
+            printf("%s%c", edge ? "|" : " ", kCellChar[res[j][i].cls]);
+        }
+        printf("%s\n", (rs[j] >= m->rateMin && rs[j] <= m->rateMax) ? "  <" : "");
+    }
+
+    // Safe box: the largest diverge-free rectangle of grid cells (rows =
+    // RATE span, columns = CHAOS span), by area; O(G^3)
+    int bestLo = -1, bestHi = -1, bestJ0 = -1, bestJ1 = -1, bestArea = 0;
+    for (int j0 = 0; j0 < G; j0++) {
+        bool clean[64];
+        for (int i = 0; i < G; i++) clean[i] = true;
+        for (int j1 = j0; j1 < G; j1++) {
+            for (int i = 0; i < G; i++) clean[i] = clean[i] && res[j1][i].cls != CELL_DIVERGED;
+            for (int i = 0, lo = -1; i <= G; i++) {
+                if (i < G && clean[i]) { if (lo < 0) lo = i; continue; }
+                if (lo >= 0 && (i - lo) * (j1 - j0 + 1) > bestArea) {
+                    bestArea = (i - lo) * (j1 - j0 + 1);
+                    bestLo = lo; bestHi = i - 1; bestJ0 = j0; bestJ1 = j1;
+                }
+                lo = -1;
+            }
+        }
+    }
+
+    int count[4] = {0, 0, 0, 0}, inBox = 0;
+    float xMin = INFINITY, xMax = -INFINITY, yMin = INFINITY, yMax = -INFINITY;
+    for (int j = 0; j < G; j++)
+        for (int i = 0; i < G; i++) {
+            const CellResult& r = res[j][i];
+            if (cs[i] < m->chaosMin || cs[i] > m->chaosMax || rs[j] < m->rateMin || rs[j] > m->rateMax) continue;
+            count[r.cls]++; inBox++;
+            if (r.cls == CELL_DIVERGED) continue;
+            xMin = fminf(xMin, r.xMin); xMax = fmaxf(xMax, r.xMax);
+            yMin = fminf(yMin, r.yMin); yMax = fmaxf(yMax, r.yMax);
+        }
+    if (inBox) printf("  metadata box: %d%% chaotic, %d%% periodic, %d%% fixed, %d%% diverged\n",
+                      100 * count[CELL_CHAOTIC] / inBox, 100 * count[CELL_PERIODIC] / inBox,
+                      100 * count[CELL_FIXED] / inBox, 100 * count[CELL_DIVERGED] / inBox);
+    if (bestLo < 0) { printf("  no diverge-free region on this grid\n"); return; }
+    char a[24], b[24];
+    printf("  safe (os %u):\n", (unsigned)o.os);
+    printf("        chaosMin   = %s;  chaosMax = %s;\n", lit(a, sizeof(a), cs[bestLo]), lit(b, sizeof(b), cs[bestHi]));
+    printf("        rateMin    = %s;  rateMax  = %s;\n", lit(a, sizeof(a), rs[bestJ0]), lit(b, sizeof(b), rs[bestJ1]));
+    if (isfinite(xMin) && !m->autoNorm && !m->isMap) {
+        printf("        xMin       = %.1ff;  xRange   = %.1ff;\n", xMin, xMax - xMin);
+        printf("        yMin       = %.1ff;  yRange   = %.1ff;\n", yMin, yMax - yMin);
+    }
+}
+
+static int cmdSweep(int idx, const Opts& o) {
+    if (o.grid < 2 || o.grid > 64) { fprintf(stderr, "sweep: grid 2..64\n"); return 1; }
+    FILE* csv = nullptr;
+    if (o.file) {
+        csv = fopen(o.file, "w");
+        if (!csv) { perror(o.file); return 1; }
+        fprintf(csv, "algo,chaos,rate,char,lyap,class,x_min,x_max,y_min,y_max,guard_resets\n");
+    }
+    for (int i = 0; i < kNumAlgos; i++) if (idx < 0 || i == idx) sweepOne(i, o, csv);
+    if (csv) fclose(csv);
+    return 0;
+}
+
+// Full block path per output sample: render + output stage, as in update()
+static void benchPath(ChaosBase* a, uint8_t os, float seconds, double& ns, double& cyc, float& osAvg) {
+    CvTap cv;
+    DcBlocker dcL, dcR;
+    float us[AUDIO_BLOCK_SAMPLES] = {}, xs[AUDIO_BLOCK_SAMPLES], ys[AUDIO_BLOCK_SAMPLES];
+    int16_t outL[AUDIO_BLOCK_SAMPLES], outR[AUDIO_BLOCK_SAMPLES];
+    const int blocks = (int)(seconds * kSampleRate / AUDIO_BLOCK_SAMPLES);
+    uint64_t osSum = 0;
+    auto t0 = std::chrono::steady_clock::now();
+#ifdef HOST_TSC
+    uint64_t c0 = __rdtsc();
+#endif
+    for (int b = 0; b < blocks; b++) {
+        cv.n = 0;
+        osSum += a->renderBlock(us, xs, ys, AUDIO_BLOCK_SAMPLES, os, cv);
+        OutputScale sc = outputScale(*a, xs, ys, AUDIO_BLOCK_SAMPLES);
+        softClipBlock(xs, AUDIO_BLOCK_SAMPLES, sc.gL, sc.offL);
+        softClipBlock(ys, AUDIO_BLOCK_SAMPLES, sc.gR, sc.offR);
+        dcL.process(xs, AUDIO_BLOCK_SAMPLES);
+        dcR.process(ys, AUDIO_BLOCK_SAMPLES);
+        floatToInt16Block(xs, outL, AUDIO_BLOCK_SAMPLES, 32000.0f);
+        floatToInt16Block(ys, outR, AUDIO_BLOCK_SAMPLES, 32000.0f);
+        benchBarrier(outL); benchBarrier(outR);
+    }
+#ifdef HOST_TSC
+    cyc = (double)(__rdtsc() - c0) / ((double)blocks * AUDIO_BLOCK_SAMPLES);
+#else
+    cyc = 0.0;
+#endif
+    double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    ns = s * 1e9 / ((double)blocks * AUDIO_BLOCK_SAMPLES);
+    osAvg = blocks ? (float)osSum / blocks : 0.0f;
+}
+
+static int cmdBench(int idx, const Opts& o) {
+    printf("%-12s %-5s %12s %12s %14s %12s\n", "algo", "integ", "x1 ns/smp", "x1 cyc/smp",
+           "adapt ns/smp", "adapt os");
+    for (int i = 0; i < kNumAlgos; i++) {
+        if (idx >= 0 && i != idx) continue;
+        double ns1, cyc1, nsA, cycA;
+        float os1, osA;
+        ChaosBase* a = kAlgos[i].make();
+        ChaosParams p = { 0.5f * (a->chaosMin + a->chaosMax), 0.5f * (a->rateMin + a->rateMax),
+                          0.5f * (a->charMin + a->charMax) };
+        a->init(); a->post(p);
+        benchPath(a, 1, o.seconds, ns1, cyc1, os1);
+        a->init();
+        benchPath(a, OS_ADAPTIVE, o.seconds, nsA, cycA, osA);
+        printf("%-12s %-5s %12.1f %12.0f %14.1f %12.2f\n", a->name, a->integName, ns1, cyc1, nsA, osA);
+        delete a;
+    }
+    printf("(host timings; realtime at 44.1 kHz is %.0f ns/sample)\n", 1e9 / kSampleRate);
+    return 0;
+}
+
+// ─── main ─────────────────────────────────────────────────────────────────────
+static int usage() {
+    fprintf(stderr,
+            "usage: chaos-host list\n"
+            "       chaos-host render <algo> [-c CHAOS] [-r RATE] [-k CHAR] [-t SEC] [-o OS] [-u HZ] -f out.wav|out.csv\n"
+            "       chaos-host sweep  <algo|all> [-n GRID] [-k CHAR] [-t SEC] [-o OS] [-f cells.csv]\n"
+            "       chaos-host bench  [algo|all] [-t SEC]\n"
+            "OS: 1 2 4 8, or 0 = adaptive (render/bench only; sweep twins need a fixed factor)\n");
+    return 2;
+}
+
+int main(int argc, char** argv) {
+    for (int i = 0; i < kNumAlgos; i++) gProto[i] = kAlgos[i].make();
+    if (argc < 2) return usage();
+    const char* cmd = argv[1];
+    int argi = 2, idx = -1;
+    if (argi < argc && argv[argi][0] != '-') {
+        if (strcmp(argv[argi], "all") != 0) {
+            idx = findAlgo(argv[argi]);
+            if (idx < 0) { fprintf(stderr, "unknown algorithm '%s' (see 'list')\n", argv[argi]); return 2; }
+        }
+        argi++;
+    }
+    Opts o;
+    bool benchDefault = true;
+    for (; argi + 1 < argc; argi += 2) {
+        const char* f = argv[argi];
+        const char* v = argv[argi + 1];
+        if      (!strcmp(f, "-c")) o.chaos   = strtof(v, nullptr);
+        else if (!strcmp(f, "-r")) o.rate    = strtof(v, nullptr);
+        else if (!strcmp(f, "-k")) o.charV   = strtof(v, nullptr);
+        else if (!strcmp(f, "-t")) { o.seconds = strtof(v, nullptr); benchDefault = false; }
+        else if (!strcmp(f, "-n")) o.grid    = atoi(v);
+        else if (!strcmp(f, "-o")) o.os      = (uint8_t)atoi(v);
+        else if (!strcmp(f, "-u")) o.forceHz = strtof(v, nullptr);
+        else if (!strcmp(f, "-f")) o.file    = v;
+        else return usage();
+    }
+    if (argi != argc) return usage();
+    if (o.os != OS_ADAPTIVE && o.os != 1 && o.os != 2 && o.os != 4 && o.os != 8) return usage();
+
+    if (!strcmp(cmd, "list")) return cmdList();
+    if (!strcmp(cmd, "render")) return idx < 0 ? usage() : cmdRender(idx, o);
+    if (!strcmp(cmd, "sweep")) {
+        if (o.os == OS_ADAPTIVE) return usage();
+        return cmdSweep(idx, o);
+    }
+    if (!strcmp(cmd, "bench")) {
+        if (benchDefault) o.seconds = 2.0f;
+        return cmdBench(idx, o);
+    }
+    return usage();
+}
@@ -1,5 +1,5 @@
 /*  DaisyMFX — Simplified (2 banks: Reverb x4, Delay x4)
-    Kept: CV tap, wet fade on patch change, shimmer warm-up, OLED sleep, CV takeover.
+    Kept: CV tap, dual-engine crossfade on patch change, shimmer warm-up, OLED sleep, CV takeover.
     Removed: Banks C/D (Mods/Utils) and all related DSP/state/UI.
 */
 
@@ -9,8 +9,11 @@
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
 #include "pins.h"
+#include "multitap.h"
+#include "modulation.h"
 #include <math.h>
 #include <cstring>
+#include <type_traits>
 
 using namespace daisysp;
 using namespace daisy;
@@ -22,6 +25,7 @@ using namespace daisy;
 #define UI_IDLE_SLEEP_MS        15000
 #define UI_CHANGE_EPS           0.005f
 #define UI_LOW_CONTRAST         0x10
+#define UI_LOAD_REFRESH_MS      500
 #define I2C_CLOCK_HZ            100000
 #define BTN_DEBOUNCE_MS         25
 #define BTN_LONG_MS             800
@@ -37,8 +41,13 @@ Adafruit_SSD1306 oled(OLED_W, OLED_H, &Wire);
 // ================== DSP / utils ==================
 DaisyHardware hw;
 float samplerate = 48000.f;
+#define MFX_MAX_BLOCK 256   // callback works in chunks of at most this many samples
+#ifndef MFX_BLOCK_SIZE
+#define MFX_BLOCK_SIZE 48   // default audio block; hold the button at power-up to pick another
+#endif
+static const size_t kBlockSizes[] = { 16, 32, 48, 64, 96, 128, 256 };
+size_t g_block_size = MFX_BLOCK_SIZE;
 inline float clampf(float x, float a, float b){ return x < a ? a : (x > b ? b : x); }
-inline float sin01(float ph){ return sinf(2.f * 3.14159265f * ph); }
 inline float map_exp01(float x01, float minv, float maxv){
   x01 = clampf(x01, 0.f, 1.f); float lnmin = logf(minv), lnrange = logf(maxv) - lnmin;
   return expf(lnmin + x01 * lnrange);
@@ -48,19 +57,6 @@ inline float map_lin01(float x01, float minv, float maxv){
 }
 inline void onepole_lp(float xL, float xR, float a, float &yL, float &yR){ yL += a*(xL-yL); yR += a*(xR-yR); }
 
-// ---- Reverb core (Bank A) ----
-DSY_SDRAM_BSS static ReverbSc verb;
-DSY_SDRAM_BSS static DelayLine<float, 12000> preL_A2, preR_A2;   // Plate predelay
-DSY_SDRAM_BSS static DelayLine<float, 16000> preL_A3, preR_A3;   // Tank predelay
-DSY_SDRAM_BSS static DelayLine<float, 1200>  a3mL, a3mR;         // Tank light modulation
-float a3_phL = 0.f, a3_phR = 0.5f;
-DSY_SDRAM_BSS static PitchShifter shifter;                       // Shimmer
-
-// ---- Delays (Bank B) ----
-DSY_SDRAM_BSS static DelayLine<float, 96000> dlyL, dlyR;         // up to ~2 s @ 48k safely
-float tape_ph=0.f;
-float fb_lpL=0.f, fb_lpR=0.f;
-
 // ================== Output post-filters ==================
 struct DcBlock { float R, x1, y1; inline float Process(float x){ float y=x-x1+R*y1; x1=x; y1=y; return y; } } dcL, dcR;
 struct OnePoleLP { float a=0.f,y=0.f; inline void SetCutoff(float fc,float fs){ float alpha=1.f-expf(-2.f*3.14159265f*fc/fs); a=clampf(alpha,0.f,1.f);} inline float Process(float x){ y+=a*(x-y); return y; } } oplpL, oplpR;
@@ -88,208 +84,437 @@ bool g_oled_awake = true; uint32_t g_last_user_ms = 0;
 inline void OledSleep(){ Wire.setClock(100000); if(!g_oled_awake) return; oled.ssd1306_command(SSD1306_DISPLAYOFF); g_oled_awake=false; }
 inline void OledWake(){ Wire.setClock(400000); if(g_oled_awake) return; oled.ssd1306_command(SSD1306_DISPLAYON); g_oled_awake=true; }
 
-// --- Patch/blast protection ---
-static int g_patch_fade_samps = 0;
-static int g_shimmer_warm_samps = 0;
-static const int PATCH_FADE_SAMPS   = 2048;  // ~43 ms @ 48k
+// ================== FX ENGINES ==================
+// Two complete effect chains. The live engine renders the current patch; a
+// patch change brings the idle engine up with the new patch, runs both through
+// an equal-power crossfade, then retires the old one and clears it in the
+// background. Engines live in SDRAM, which is neither zeroed nor constructed
+// at boot, so FxEngine has no member initialisers — see EngineInit().
+static const int XFADE_SAMPS        = 2048;  // ~43 ms @ 48k
 static const int SHIMMER_WARM_SAMPS = 8192;  // ~170 ms @ 48k
+static const int CLEAR_BYTES_PER_SAMPLE = 160;  // background clear slice (~7.5 KB per 48-sample block)
+
+// Modulated-delay interpolation (A3); serial key 'i' cycles it at runtime
+#ifndef MFX_MOD_INTERP
+#define MFX_MOD_INTERP INTERP_HERMITE
+#endif
+volatile uint8_t g_mod_interp = MFX_MOD_INTERP;
+float g_lfoSine[LFO_TABLE_SIZE + 1];
+
+// Control-stage outputs. Pots/CV change at loop() rate, so everything derived
+// from them (takeover, log/exp mapping, LFOs, reverb settings) is worked out
+// once per block; the audio stage only glides delay times and follows ramps.
+struct Ctl {
+  float p2, p3;                 // after CV takeover
+  float target;                 // predelay / delay time target, samples
+  float fb, tone_a, send;       // delay feedback, its LP coeff, B4 reverb send
+  float shim;                   // A4 shimmer level
+};
+
+struct PatchProc;
+// Delay-line groups a patch writes to; a retired engine only clears those
+enum SpanGroup : uint8_t { SPAN_PRE_A2=1<<0, SPAN_PRE_A3=1<<1, SPAN_A3MOD=1<<2, SPAN_DLY=1<<3, SPAN_MTAP=1<<4 };
+enum EngineState : uint8_t { ENG_LIVE, ENG_CLEARING, ENG_READY };
+
+struct FxEngine {
+  ReverbSc verb;                              // Bank A core, B4 macro
+  DelayLine<float, 12000> preL_A2, preR_A2;   // Plate predelay
+  DelayLine<float, 16000> preL_A3, preR_A3;   // Tank predelay
+  ModDelay<2048> a3mL, a3mR;                  // Tank light modulation
+  PitchShifter shifter;                       // Shimmer
+  DelayLine<float, 96000> dlyL, dlyR;         // up to ~2 s @ 48k safely
+  MultiTapDelay<131072, 16, MFX_MAX_BLOCK> mtap;             // MultiTap (~2.7 s @ 48k)
+
+  const PatchProc* proc;
+  Ctl ctl;
+  float glide; bool glideInit;                // predelay / delay time, samples
+  Lfo a3LfoL, a3LfoR;                         // Tank modulation
+  Lfo b2Wow, b2Flutter;                       // Tape
+  float fb_lpL, fb_lpR;
+  int shimWarm;                               // shimmer warm-up samples left
+
+  volatile uint8_t state;                     // EngineState
+  volatile bool libReady;                     // verb/shifter re-initialised (loop)
+  uint32_t clearPos;                          // bytes of delay lines cleared (callback)
+  uint8_t  clearMask;                         // SpanGroups the running patch writes
+};
+DSY_SDRAM_BSS static FxEngine eng[2];
+
+// The delay lines are plain arrays behind a small header, so clearing their
+// bytes is the same as Init(): write head 0, silent buffer. That lets the
+// callback zero them a slice per block instead of in one 100k-float loop.
+static_assert(std::is_trivially_copyable<DelayLine<float, 16>>::value, "DelayLine must be byte-clearable");
+struct ClearSpan { void* p; size_t n; uint8_t group; };
+#define ENG_SPANS(e) { {&e.preL_A2,sizeof e.preL_A2,SPAN_PRE_A2}, {&e.preR_A2,sizeof e.preR_A2,SPAN_PRE_A2}, \
+                       {&e.preL_A3,sizeof e.preL_A3,SPAN_PRE_A3}, {&e.preR_A3,sizeof e.preR_A3,SPAN_PRE_A3}, \
+                       {&e.a3mL,sizeof e.a3mL,SPAN_A3MOD},        {&e.a3mR,sizeof e.a3mR,SPAN_A3MOD},        \
+                       {&e.dlyL,sizeof e.dlyL,SPAN_DLY},          {&e.dlyR,sizeof e.dlyR,SPAN_DLY},          \
+                       {&e.mtap,sizeof e.mtap,SPAN_MTAP} }
+
+// Zero up to `budget` bytes of the clearMask lines from clearPos on (clearPos
+// counts masked bytes only); true once they are all clear.
+static bool EngineClearSlice(FxEngine& e, size_t budget){
+  const ClearSpan spans[] = ENG_SPANS(e);
+  size_t base=0;
+  for(const ClearSpan& sp : spans){
+    if(!(sp.group & e.clearMask)) continue;
+    if(budget && e.clearPos < base+sp.n){
+      size_t off=e.clearPos-base, k=sp.n-off; if(k>budget) k=budget;
+      memset((uint8_t*)sp.p+off,0,k); e.clearPos+=k; budget-=k;
+    }
+    base+=sp.n;
+  }
+  return e.clearPos>=base;
+}
 
-static void ResetFxForBankPatch(){
-  verb.Init(samplerate);
-  dlyL.Reset(); dlyR.Reset();
-  fb_lpL = fb_lpR = 0.f;
-  a3_phL = 0.f; a3_phR = 0.5f; tape_ph = 0.f;
-
-  // Clear short mod/predelay lines
-  for(int k=0;k<16000;++k){ if(k<12000){ preL_A2.Write(0.f); preR_A2.Write(0.f); } if(k<16000){ preL_A3.Write(0.f); preR_A3.Write(0.f); } if(k<1200){ a3mL.Write(0.f); a3mR.Write(0.f); } }
-
-  // Arm fades
-  g_patch_fade_samps = PATCH_FADE_SAMPS;
-  if(bankSel == BANK_A && patchIdx == A4_SHIMMER){
-    g_shimmer_warm_samps = SHIMMER_WARM_SAMPS;
-    shifter.Init(samplerate);
-    shifter.SetTransposition(12.f);
-  } else {
-    g_shimmer_warm_samps = 0;
+// ReverbSc/PitchShifter keep their buffers private and clear them inside Init()
+// in one pass, so that part of a reset runs from loop(), which the audio
+// callback preempts, rather than from the callback.
+static void EngineLibInit(FxEngine& e){
+  e.verb.Init(samplerate);
+  e.shifter.Init(samplerate); e.shifter.SetTransposition(12.f);
+}
+
+// Boot-time setup (before the audio starts): everything at once.
+static void EngineInit(FxEngine& e){
+  EngineLibInit(e);
+  e.preL_A2.Init(); e.preR_A2.Init();
+  e.preL_A3.Init(); e.preR_A3.Init();
+  e.a3mL.Reset(); e.a3mR.Reset();
+  e.dlyL.Init(); e.dlyR.Init();
+  e.mtap.Reset();
+  e.proc=nullptr; e.clearPos=0; e.clearMask=0; e.libReady=true; e.state=ENG_READY;
+}
+
+// Retire an engine after its fade-out: the callback clears the delay lines,
+// loop() re-initialises the library objects, then it is READY again.
+static void EngineRetire(FxEngine& e){
+  e.clearPos=0; e.libReady=false; e.state=ENG_CLEARING;
+}
+
+// Background half of the clear; called from loop().
+static void EngineService(){
+  for(FxEngine& e : eng){
+    if(e.state==ENG_CLEARING && !e.libReady){ EngineLibInit(e); __DMB(); e.libReady=true; }
+  }
+}
+
+// ================== CONTROL STAGE (once per block) ==================
+inline float DelayTarget(const Ctl& c, float lo_ms, float hi_ms){
+  return g_have_tap ? clampf(tap_delay_samps,10.f,95990.f)
+                    : clampf(map_exp01(c.p2,lo_ms,hi_ms)*0.001f*samplerate,10.f,95990.f);
+}
+
+static void A1_Control(FxEngine& e, size_t){
+  e.verb.SetFeedback(map_lin01(e.ctl.p2,0.70f,0.98f)); e.verb.SetLpFreq(map_lin01(e.ctl.p3,1000.f,18000.f));
+}
+static void A2_Control(FxEngine& e, size_t){
+  Ctl& c=e.ctl;
+  c.target=clampf(map_exp01(c.p2,10.f,80.f)*0.001f*samplerate,1.f,11999.f);
+  e.verb.SetFeedback(map_lin01(0.6f+0.4f*c.p2,0.75f,0.97f)); e.verb.SetLpFreq(map_lin01(c.p3,12000.f,18000.f));
+}
+static void A3_Control(FxEngine& e, size_t){
+  Ctl& c=e.ctl;
+  c.target=clampf(map_exp01(c.p2,30.f,200.f)*0.001f*samplerate,1.f,15999.f);
+  e.verb.SetFeedback(map_lin01(0.5f+0.5f*c.p2,0.85f,0.985f)); e.verb.SetLpFreq(map_lin01(1.f-c.p3,3000.f,12000.f));
+}
+static void A4_Control(FxEngine& e, size_t){
+  e.verb.SetFeedback(map_lin01(e.ctl.p2,0.75f,0.98f)); e.verb.SetLpFreq(map_lin01(e.ctl.p3,1500.f,16000.f));
+  e.ctl.shim=clampf(e.ctl.p3,0.f,1.f)*0.7f;
+}
+static void B1_Control(FxEngine& e, size_t){
+  e.ctl.target=DelayTarget(e.ctl,10.f,800.f);
+  e.ctl.fb=clampf(e.ctl.p3,0.f,0.90f);
+}
+static void B2_Control(FxEngine& e, size_t){
+  Ctl& c=e.ctl;
+  c.target=clampf(map_exp01(c.p2,20.f,800.f)*0.001f*samplerate,10.f,95000.f);   // wow/flutter added per sample
+  c.fb=clampf(c.p3,0.f,0.90f);
+  c.tone_a=map_lin01(c.fb,0.10f,0.35f);
+}
+// MultiTap: B3_TAPS taps spread over 0.5–1.5 × Time, fading and darkening
+// along the line, alternately panned by Width (P3). No feedback, as the
+// original three-tap B3.
+static const int B3_TAPS = 8;
+static void B3_Control(FxEngine& e, size_t n){
+  Ctl& c=e.ctl;
+  c.target=clampf(map_exp01(c.p2,60.f,900.f)*0.001f*samplerate,10.f,63990.f);
+  // Time glide at block rate (same time constant as the per-sample fonepole)
+  if(!e.glideInit){ e.glide=c.target; e.glideInit=true; }
+  else e.glide+=(1.f-powf(1.f-0.0015f,(float)n))*(c.target-e.glide);
+  float width=clampf(c.p3,0.f,1.f);
+  e.mtap.SetTapCount(B3_TAPS);
+  for(int t=0;t<B3_TAPS;t++){
+    float k=t/(float)(B3_TAPS-1);
+    auto& tp=e.mtap.tap(t);
+    tp.delay=(0.5f+k)*e.glide;
+    tp.level=map_lin01(k,1.f,0.5f);
+    tp.pan=((t&1)?1.f:-1.f)*(0.25f+0.75f*k)*width;
+    tp.tone=map_lin01(k,1.f,0.35f);
+    tp.fb=0.f; tp.cross=false;
   }
 }
+static void B4_Control(FxEngine& e, size_t){
+  Ctl& c=e.ctl;
+  c.target=DelayTarget(c,30.f,900.f);
+  float fb01=clampf(c.p3,0.f,1.f);
+  c.fb=clampf(fb01,0.f,0.90f);
+  c.tone_a=map_lin01(fb01,0.10f,0.35f);
+  c.send=map_lin01(fb01,0.20f,0.60f);
+  e.verb.SetFeedback(0.88f); e.verb.SetLpFreq(map_lin01(1.f-fb01,5000.f,14000.f));
+}
+
+// ================== AUDIO STAGE (per-patch block processors) ==================
+// in → wet over a whole block; no bank/patch branching per sample.
+typedef void (*BlockFn)(FxEngine& e, const float* inL, const float* inR, float* wL, float* wR, size_t n);
+
+// Predelay/delay time glide; snaps to the target on the engine's first block
+inline void GlideStart(FxEngine& e){ if(!e.glideInit){ e.glide=e.ctl.target; e.glideInit=true; } }
+
+static void A1_Block(FxEngine& e, const float* inL, const float* inR, float* wL, float* wR, size_t n){
+  for(size_t i=0;i<n;i++) e.verb.Process(inL[i],inR[i],&wL[i],&wR[i]);
+}
+static void A2_Block(FxEngine& e, const float* inL, const float* inR, float* wL, float* wR, size_t n){
+  GlideStart(e);
+  for(size_t i=0;i<n;i++){
+    fonepole(e.glide,e.ctl.target,0.0015f);
+    e.preL_A2.SetDelay(e.glide); e.preR_A2.SetDelay(e.glide);
+    float xL=e.preL_A2.Read(), xR=e.preR_A2.Read();
+    e.preL_A2.Write(inL[i]); e.preR_A2.Write(inR[i]);
+    e.verb.Process(xL,xR,&wL[i],&wR[i]);
+  }
+}
+// Tank modulation read, interpolation chosen once per block (g_mod_interp)
+template<Interp M>
+static void A3_Run(FxEngine& e, const float* inL, const float* inR, float* wL, float* wR, size_t n){
+  const float base=0.006f*samplerate, depth=0.002f*samplerate;
+  for(size_t i=0;i<n;i++){
+    fonepole(e.glide,e.ctl.target,0.0015f);
+    e.preL_A3.SetDelay(e.glide); e.preR_A3.SetDelay(e.glide);
+    float xL=e.preL_A3.Read(), xR=e.preR_A3.Read();
+    e.preL_A3.Write(inL[i]); e.preR_A3.Write(inR[i]);
+    float mmL=e.a3mL.Read<M>(base+depth*e.a3LfoL.Process()); e.a3mL.Write(xL);
+    float mmR=e.a3mR.Read<M>(base+depth*e.a3LfoR.Process()); e.a3mR.Write(xR);
+    e.verb.Process(mmL,mmR,&wL[i],&wR[i]);
+  }
+}
+static void A3_Block(FxEngine& e, const float* inL, const float* inR, float* wL, float* wR, size_t n){
+  GlideStart(e);
+  switch(g_mod_interp){
+    case INTERP_LINEAR:  A3_Run<INTERP_LINEAR>(e,inL,inR,wL,wR,n);  break;
+    case INTERP_ALLPASS: A3_Run<INTERP_ALLPASS>(e,inL,inR,wL,wR,n); break;
+    default:             A3_Run<INTERP_HERMITE>(e,inL,inR,wL,wR,n); break;
+  }
+}
+static void A4_Block(FxEngine& e, const float* inL, const float* inR, float* wL, float* wR, size_t n){
+  // Warm-up ramp 0→1 over SHIMMER_WARM_SAMPS, continued across blocks
+  const float inc=1.f/SHIMMER_WARM_SAMPS;
+  float warm=1.f-e.shimWarm*inc;
+  e.shimWarm = e.shimWarm > (int)n ? e.shimWarm-(int)n : 0;
+  for(size_t i=0;i<n;i++){
+    float vL,vR; e.verb.Process(inL[i],inR[i],&vL,&vR);
+    float mono=0.5f*(vL+vR);
+    float shim=e.shifter.Process(mono)*e.ctl.shim*warm;
+    warm=fminf(warm+inc,1.f);
+    wL[i]=vL+shim; wR[i]=vR+shim;
+  }
+}
+static void B1_Block(FxEngine& e, const float* inL, const float* inR, float* wL, float* wR, size_t n){
+  GlideStart(e);
+  for(size_t i=0;i<n;i++){
+    fonepole(e.glide,e.ctl.target,0.0015f);
+    e.dlyL.SetDelay(e.glide); e.dlyR.SetDelay(e.glide);
+    float dl=e.dlyL.Read(), dr=e.dlyR.Read();
+    e.dlyL.Write(inL[i]+dr*e.ctl.fb);
+    e.dlyR.Write(inR[i]+dl*e.ctl.fb);
+    wL[i]=dl; wR[i]=dr;
+  }
+}
+static void B2_Block(FxEngine& e, const float* inL, const float* inR, float* wL, float* wR, size_t n){
+  GlideStart(e);
+  for(size_t i=0;i<n;i++){
+    fonepole(e.glide,e.ctl.target,0.0015f);
+    float t=e.glide*(1.f+0.0025f*e.b2Wow.Process()+0.0006f*e.b2Flutter.Process());
+    e.dlyL.SetDelay(t); e.dlyR.SetDelay(t);
+    float dl=e.dlyL.Read(), dr=e.dlyR.Read();
+    onepole_lp(dl,dr,e.ctl.tone_a,e.fb_lpL,e.fb_lpR);
+    e.dlyL.Write(inL[i]+e.fb_lpL*e.ctl.fb);
+    e.dlyR.Write(inR[i]+e.fb_lpR*e.ctl.fb);
+    wL[i]=dl; wR[i]=dr;
+  }
+}
+static void B3_Block(FxEngine& e, const float* inL, const float* inR, float* wL, float* wR, size_t n){
+  e.mtap.Process(inL,inR,wL,wR,n);
+}
+static void B4_Block(FxEngine& e, const float* inL, const float* inR, float* wL, float* wR, size_t n){
+  GlideStart(e);
+  for(size_t i=0;i<n;i++){
+    fonepole(e.glide,e.ctl.target,0.0015f);
+    e.dlyL.SetDelay(e.glide); e.dlyR.SetDelay(e.glide);
+    float dl=e.dlyL.Read(), dr=e.dlyR.Read();
+    onepole_lp(dl,dr,e.ctl.tone_a,e.fb_lpL,e.fb_lpR);
+    e.dlyL.Write(inL[i]+e.fb_lpL*e.ctl.fb); e.dlyR.Write(inR[i]+e.fb_lpR*e.ctl.fb);
+    float vL,vR; e.verb.Process(dl*e.ctl.send,dr*e.ctl.send,&vL,&vR);
+    wL[i]=dl+vL; wR[i]=dr+vR;
+  }
+}
+
+struct PatchProc { void (*control)(FxEngine& e, size_t n); BlockFn block; uint8_t spans; };
+static const PatchProc kPatches[2][4] = {
+  { {A1_Control,A1_Block,0}, {A2_Control,A2_Block,SPAN_PRE_A2},
+    {A3_Control,A3_Block,SPAN_PRE_A3|SPAN_A3MOD}, {A4_Control,A4_Block,0} },
+  { {B1_Control,B1_Block,SPAN_DLY}, {B2_Control,B2_Block,SPAN_DLY},
+    {B3_Control,B3_Block,SPAN_MTAP}, {B4_Control,B4_Block,SPAN_DLY} },
+};
+
+// Bring a READY engine up on a patch (fresh buffers, state from scratch)
+static void EngineStart(FxEngine& e, Bank bank, int patch){
+  e.proc=&kPatches[bank==BANK_A ? 0 : 1][patch & 3];
+  e.clearMask=e.proc->spans;   // what EngineRetire's clear will have to zero
+  e.glideInit=false;
+  e.a3LfoL.Init(samplerate,0.15f,LFO_SINE,0.f); e.a3LfoR.Init(samplerate,0.15f,LFO_SINE,0.8f);
+  e.b2Wow.Init(samplerate,0.6f,LFO_SINE); e.b2Flutter.Init(samplerate,5.5f,LFO_RANDOM,0.f,millis()|1u);
+  e.fb_lpL=e.fb_lpR=0.f;
+  e.shimWarm = (bank==BANK_A && patch==A4_SHIMMER) ? SHIMMER_WARM_SAMPS : 0;
+  e.state=ENG_LIVE;
+}
+
+// ================== PATCH TRANSITIONS ==================
+// loop() only posts a change; the callback starts the crossfade once the idle
+// engine is READY (a switch right after another waits for the clear). Bank and
+// patch travel packed in one byte, so the callback never sees a half-made
+// selection; a newer request simply overwrites a pending one.
+static const uint8_t PATCH_REQ = 0x80;  // | bank<<2 | patch; 0 = none
+volatile uint8_t g_patch_req = 0;
+static int g_live = 0, g_fading = -1;   // engine indices (-1: no crossfade)
+static int g_xf_pos = 0;                // crossfade position, samples
+inline void RequestPatchChange(){ g_patch_req = PATCH_REQ | (uint8_t)(bankSel<<2) | (uint8_t)(patchIdx & 3); }
+
+// ================== CPU meter ==================
+// DWT cycles per callback against the block's real-time budget
+// (SystemCoreClock × block / samplerate): last, running average, peak since
+// the last serial report, and per-patch maxima (a crossfade is charged to the
+// incoming patch). loop() shows the average on the OLED and reports serially.
+struct CpuMeter {
+  volatile uint32_t last, peak;
+  volatile float avg;                 // cycles, one-pole over ~100 callbacks
+  volatile uint32_t patchMax[2][4];
+  float budget;                       // cycles per block at 100 %
+} g_cpu;
+inline float CpuPct(float cyc){ return g_cpu.budget>0.f ? 100.f*cyc/g_cpu.budget : 0.f; }
+static void CpuMeterReset(){
+  g_cpu.last=g_cpu.peak=0; g_cpu.avg=0.f;
+  for(auto& b : g_cpu.patchMax) for(auto& m : b) m=0;
+}
+
+static void CycleCounterInit(){
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->LAR = 0xC5ACCE55;   // unlock (Cortex-M7)
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+// Boot-time cost of the modulation primitives on this chip (serial only):
+// DWT cycles per read for each interpolation mode, and per LFO sample
+// against sinf(). Runs on an idle engine's line before the audio starts.
+static void BenchModulation(){
+  if(!Serial) return;
+  const int N=4096; volatile float sink=0.f; float acc=0.f;
+  ModDelay<2048>& md=eng[1].a3mL; md.Reset();
+  for(int i=0;i<2048;i++) md.Write(sinf(i*0.01f));
+  for(int m=0;m<INTERP_COUNT;m++){
+    uint32_t t0=DWT->CYCCNT;
+    for(int i=0;i<N;i++){
+      float d=300.f+100.f*(i*(1.f/N));
+      acc+= m==INTERP_LINEAR ? md.Read<INTERP_LINEAR>(d) : m==INTERP_HERMITE ? md.Read<INTERP_HERMITE>(d) : md.Read<INTERP_ALLPASS>(d);
+    }
+    uint32_t cyc=DWT->CYCCNT-t0;
+    Serial.printf("[mfx] interp %-7s %.1f cyc/read\n",kInterpName[m],(float)cyc/N);
+  }
+  md.Reset();
+  const LfoShape shapes[3]={LFO_SINE,LFO_TRI,LFO_RANDOM}; const char* names[3]={"sine","tri","random"};
+  for(int k=0;k<3;k++){
+    Lfo l; l.Init(samplerate,0.5f,shapes[k]);
+    uint32_t t0=DWT->CYCCNT;
+    for(int i=0;i<N;i++) acc+=l.Process();
+    Serial.printf("[mfx] lfo %-6s %.1f cyc/sample\n",names[k],(float)(DWT->CYCCNT-t0)/N);
+  }
+  uint32_t t0=DWT->CYCCNT;
+  for(int i=0;i<N;i++) acc+=sinf(i*0.0013f);
+  Serial.printf("[mfx] sinf        %.1f cyc/sample\n",(float)(DWT->CYCCNT-t0)/N);
+  sink=acc; (void)sink;
+}
 
 // ================== AUDIO CALLBACK ==================
+float mix_prev=0.f;
+
 void AudioCallback(float **in, float **out, size_t size)
 {
-  for(size_t i=0;i<size;i++)
-  {
-    float dryL=in[0][i], dryR=in[1][i];
-
-    // Per-sample patch fade
-    float patch_fade = 1.f;
-    if(g_patch_fade_samps > 0){
-      patch_fade = 1.f - (g_patch_fade_samps / (float)PATCH_FADE_SAMPS);
-      g_patch_fade_samps--;
+  uint32_t t0=DWT->CYCCNT;
+  for(size_t base=0; base<size; base+=MFX_MAX_BLOCK){
+    size_t n = (size-base < MFX_MAX_BLOCK) ? size-base : MFX_MAX_BLOCK;
+    const float* inL=in[0]+base; const float* inR=in[1]+base;
+    float* oL=out[0]+base; float* oR=out[1]+base;
+
+    // Patch change: start the incoming engine once the idle one is clean
+    FxEngine& idle=eng[g_live^1];
+    uint8_t req=g_patch_req;
+    if(req && g_fading<0 && idle.state==ENG_READY){
+      g_patch_req=0;
+      EngineStart(idle,(Bank)((req>>2)&1),req&3);
+      g_fading=g_live; g_live^=1; g_xf_pos=0;
     }
 
-    float wetL=dryL, wetR=dryR;
-    float P2ctrl = toP2.update(P2) ? cv_uni01(CV1_volts) : P2;
-    float P3ctrl = toP3.update(P3) ? cv_uni01(CV2_volts) : P3;
-
-    if(bankSel==BANK_A){
-      switch(static_cast<PatchA>(patchIdx)){
-        case A1_CLASSIC:{
-          float decay=map_lin01(P2ctrl,0.70f,0.98f);
-          float tone =map_lin01(P3ctrl,1000.f,18000.f);
-          verb.SetFeedback(decay); verb.SetLpFreq(tone);
-          verb.Process(dryL,dryR,&wetL,&wetR);
-        }break;
-
-        case A2_PLATE:{
-          static float pre=0.f;
-          float pre_ms=map_exp01(P2ctrl,10.f,80.f);
-          float target=clampf(pre_ms*0.001f*samplerate,1.f,11999.f);
-          fonepole(pre,target,0.0015f);
-          preL_A2.SetDelay(pre); preR_A2.SetDelay(pre);
-          float inL=preL_A2.Read(), inR=preR_A2.Read();
-          preL_A2.Write(dryL); preR_A2.Write(dryR);
-          float tone=map_lin01(P3ctrl,12000.f,18000.f);
-          float decay=map_lin01(0.6f+0.4f*P2ctrl,0.75f,0.97f);
-          verb.SetFeedback(decay); verb.SetLpFreq(tone);
-          verb.Process(inL,inR,&wetL,&wetR);
-        }break;
-
-        case A3_TANK:{
-          static float pre=0.f;
-          float pre_ms=map_exp01(P2ctrl,30.f,200.f);
-          float target=clampf(pre_ms*0.001f*samplerate,1.f,15999.f);
-          fonepole(pre,target,0.0015f);
-          preL_A3.SetDelay(pre); preR_A3.SetDelay(pre);
-          float inL=preL_A3.Read(), inR=preR_A3.Read();
-          preL_A3.Write(dryL); preR_A3.Write(dryR);
-          float rate=0.15f/samplerate; a3_phL+=rate; if(a3_phL>=1.f) a3_phL-=1.f;
-          a3_phR+=rate; if(a3_phR>=1.f) a3_phR-=1.f;
-          a3mL.SetDelay(clampf(samplerate*(0.006f+0.002f*sin01(a3_phL)),4.f,1190.f));
-          a3mR.SetDelay(clampf(samplerate*(0.006f+0.002f*sin01(a3_phR+0.3f)),4.f,1190.f));
-          float mmL=a3mL.Read(); a3mL.Write(inL); inL=mmL;
-          float mmR=a3mR.Read(); a3mR.Write(inR); inR=mmR;
-          float decay=map_lin01(0.5f+0.5f*P2ctrl,0.85f,0.985f);
-          float tone =map_lin01(1.f-P3ctrl,3000.f,12000.f);
-          verb.SetFeedback(decay); verb.SetLpFreq(tone);
-          verb.Process(inL,inR,&wetL,&wetR);
-        }break;
-
-        case A4_SHIMMER:{
-          float decay=map_lin01(P2ctrl,0.75f,0.98f);
-          float tone =map_lin01(P3ctrl,1500.f,16000.f);
-          verb.SetFeedback(decay); verb.SetLpFreq(tone);
-          float vL,vR; verb.Process(dryL,dryR,&vL,&vR);
-          float shimmer_warm = 1.f;
-          if(g_shimmer_warm_samps > 0){
-            shimmer_warm = 1.f - (g_shimmer_warm_samps / (float)SHIMMER_WARM_SAMPS);
-            g_shimmer_warm_samps--;
-          }
-          float wetMono=0.5f*(vL+vR);
-          float shim = shifter.Process(wetMono) * clampf(P3ctrl,0.f,1.f);
-          shim *= shimmer_warm;
-          wetL = vL + shim * 0.7f;
-          wetR = vR + shim * 0.7f;
-        }break;
+    // Control stage: takeover once per block, then each running engine's mapping
+    float p2 = toP2.update(P2) ? cv_uni01(CV1_volts) : P2;
+    float p3 = toP3.update(P3) ? cv_uni01(CV2_volts) : P3;
+    FxEngine& live=eng[g_live];
+    live.ctl.p2=p2; live.ctl.p3=p3; live.proc->control(live,n);
+
+    // Audio stage
+    float wL[MFX_MAX_BLOCK], wR[MFX_MAX_BLOCK];
+    live.proc->block(live,inL,inR,wL,wR,n);
+
+    if(g_fading>=0){
+      // Equal-power crossfade (cos/sin), both engines fed the same input. The
+      // gain pair is re-seeded per block and rotated per sample.
+      FxEngine& old=eng[g_fading];
+      old.ctl.p2=p2; old.ctl.p3=p3; old.proc->control(old,n);
+      float oWL[MFX_MAX_BLOCK], oWR[MFX_MAX_BLOCK];
+      old.proc->block(old,inL,inR,oWL,oWR,n);
+      const float dth=1.5707963f/XFADE_SAMPS, cd=cosf(dth), sd=sinf(dth);
+      float th=dth*g_xf_pos, gOut=cosf(th), gIn=sinf(th);
+      size_t nx = (size_t)(XFADE_SAMPS-g_xf_pos) < n ? (size_t)(XFADE_SAMPS-g_xf_pos) : n;
+      for(size_t i=0;i<nx;i++){
+        wL[i]=gIn*wL[i]+gOut*oWL[i]; wR[i]=gIn*wR[i]+gOut*oWR[i];
+        float c=gOut*cd-gIn*sd; gIn=gIn*cd+gOut*sd; gOut=c;
       }
+      g_xf_pos+=(int)nx;
+      if(g_xf_pos>=XFADE_SAMPS){ EngineRetire(old); g_fading=-1; }
     }
-    else // BANK_B
-    {
-      switch(static_cast<PatchB>(patchIdx)){
-        case B1_PING:{
-          static float tS=24000.f; static bool init=false;
-          float targ = g_have_tap ? clampf(tap_delay_samps,10.f,95990.f)
-                                  : clampf(map_exp01(P2ctrl,10.f,800.f)*0.001f*samplerate,10.f,95990.f);
-          if(!init){ tS=targ; init=true; }
-          fonepole(tS,targ,0.0015f);
-          dlyL.SetDelay(tS); dlyR.SetDelay(tS);
-          float dl=dlyL.Read(), dr=dlyR.Read();
-          float fb=clampf(P3ctrl,0.f,0.90f);
-          dlyL.Write(dryL + dr*fb);
-          dlyR.Write(dryR + dl*fb);
-          wetL=dl; wetR=dr;
-        }break;
-
-        case B2_TAPE:{
-          static float tS=24000.f; static bool init=false;
-          float base_ms=map_exp01(P2ctrl,20.f,800.f);
-          tape_ph+=0.6f/samplerate; if(tape_ph>=1.f)tape_ph-=1.f;
-          float mod=1.f+0.0025f*sin01(tape_ph);
-          float targ=clampf(base_ms*mod*0.001f*samplerate,10.f,95990.f);
-          if(!init){ tS=targ; init=true; }
-          fonepole(tS,targ,0.0015f);
-          dlyL.SetDelay(tS); dlyR.SetDelay(tS);
-          float dl=dlyL.Read(), dr=dlyR.Read();
-          float fbAmt=clampf(P3ctrl,0.f,0.90f);
-          float tone_a=map_lin01(fbAmt,0.10f,0.35f);
-          float fbL=dl, fbR=dr; onepole_lp(fbL,fbR,tone_a,fb_lpL,fb_lpR);
-          dlyL.Write(dryL + fb_lpL*fbAmt);
-          dlyR.Write(dryR + fb_lpR*fbAmt);
-          wetL=dl; wetR=dr;
-        }break;
-
-        case B3_MULTITAP:{
-          static float baseS=24000.f; static bool init=false;
-          float base_ms=map_exp01(P2ctrl,60.f,900.f);
-          float targ=clampf(base_ms*0.001f*samplerate,10.f,63990.f);
-          if(!init){ baseS=targ; init=true; }
-          fonepole(baseS,targ,0.0015f);
-
-          // write once, read multiple taps
-          dlyL.SetDelay(10.f); dlyR.SetDelay(10.f);
-          dlyL.Write(dryL); dlyR.Write(dryR);
-
-          float taps[3]={0.5f*baseS,1.0f*baseS,1.5f*baseS};
-          float sumL=0.f,sumR=0.f;
-          for(int t=0;t<3;t++){
-            float d=clampf(taps[t],10.f,95990.f);
-            dlyL.SetDelay(d); dlyR.SetDelay(d);
-            float xL=dlyL.Read(), xR=dlyR.Read();
-            float pan=(t-1)*clampf(P3ctrl,0.f,1.f); // width
-            float g=clampf(1.f-0.2f*t,0.5f,1.f);
-            float l=(pan<=0.f)?1.f:(1.f-pan);
-            float r=(pan>=0.f)?1.f:(1.f+pan);
-            sumL+=xL*g*l; sumR+=xR*g*r;
-          }
-          wetL=sumL; wetR=sumR;
-        }break;
-
-        case B4_ECHOVERB:{
-          static float tS=24000.f; static bool init=false;
-          float targ = g_have_tap ? clampf(tap_delay_samps,10.f,95990.f)
-                                  : clampf(map_exp01(P2ctrl,30.f,900.f)*0.001f*samplerate,10.f,95990.f);
-          if(!init){ tS=targ; init=true; }
-          fonepole(tS,targ,0.0015f);
-          dlyL.SetDelay(tS); dlyR.SetDelay(tS);
-          float dl=dlyL.Read(), dr=dlyR.Read();
-          float fb01=clampf(P3ctrl,0.f,1.f);
-          float fb=clampf(fb01,0.f,0.90f);
-          float tone_a=map_lin01(fb01,0.10f,0.35f);
-          float fbL=dl, fbR=dr; onepole_lp(fbL,fbR,tone_a,fb_lpL,fb_lpR);
-          dlyL.Write(dryL+fb_lpL*fb); dlyR.Write(dryR+fb_lpR*fb);
-
-          float vL,vR;
-          verb.SetFeedback(0.88f);
-          verb.SetLpFreq(map_lin01(1.f-fb01,5000.f,14000.f));
-          verb.Process(dl*map_lin01(fb01,0.20f,0.60f),
-                       dr*map_lin01(fb01,0.20f,0.60f), &vL,&vR);
-          wetL=dl+vL; wetR=dr+vR;
-        }break;
-      }
+    else if(idle.state==ENG_CLEARING){
+      // Background clear of the retired engine, one slice per block
+      if(EngineClearSlice(idle,n*CLEAR_BYTES_PER_SAMPLE) && idle.libReady) idle.state=ENG_READY;
     }
 
-    // Apply universal patch fade
-    wetL *= patch_fade;
-    wetR *= patch_fade;
-
-    // Final mix + output filtering
-    float outL=(1.f-P1)*dryL + P1*wetL;
-    float outR=(1.f-P1)*dryR + P1*wetR;
-    outL = dcL.Process(outL); outR = dcR.Process(outR);
-    outL = oplpL.Process(outL); outR = oplpR.Process(outR);
-    outL = clampf(outL,-1.2f,1.2f); outR = clampf(outR,-1.2f,1.2f);
-    out[0][i]=outL; out[1][i]=outR;
+    // Output stage: mix ramped from last block's P1, DC block, LPF, clamp
+    float mix=mix_prev, dMix=(P1-mix_prev)/n; mix_prev=P1;
+    for(size_t i=0;i<n;i++){
+      float outL=(1.f-mix)*inL[i] + mix*wL[i];
+      float outR=(1.f-mix)*inR[i] + mix*wR[i];
+      mix+=dMix;
+      outL = dcL.Process(outL); outR = dcR.Process(outR);
+      outL = oplpL.Process(outL); outR = oplpR.Process(outR);
+      oL[i]=clampf(outL,-1.2f,1.2f); oR[i]=clampf(outR,-1.2f,1.2f);
+    }
   }
+  uint32_t cyc=DWT->CYCCNT-t0;
+  g_cpu.last=cyc;
+  g_cpu.avg = g_cpu.avg>0.f ? g_cpu.avg+0.01f*((float)cyc-g_cpu.avg) : (float)cyc;
+  if(cyc>g_cpu.peak) g_cpu.peak=cyc;
+  int pi=(int)(eng[g_live].proc-&kPatches[0][0]);
+  volatile uint32_t& pm=g_cpu.patchMax[pi>>2][pi&3];
+  if(cyc>pm) pm=cyc;
 }
 
 // ================== OLED (helpers) ==================
@@ -337,7 +562,7 @@ static const char* p3Label() {
   if(bankSel==BANK_A){
     return (patchIdx==A4_SHIMMER) ? "Shim" : "Tone";
   } else {
-    return (patchIdx==B4_ECHOVERB) ? "Macr" : "Fdbk";
+    switch(static_cast<PatchB>(patchIdx)){ case B3_MULTITAP: return "Wdth"; case B4_ECHOVERB: return "Macr"; default: return "Fdbk"; }
   }
 }
 
@@ -359,6 +584,8 @@ static void drawPatchUi(bool btn_pressed,bool /*showTapFlag*/){
   oled.fillRect(0,0,OLED_W,12,SSD1306_WHITE);
   oled.setTextColor(SSD1306_BLACK);
   ui::printClipped(2,2,96,patchTitleShort());
+  char load[8]; snprintf(load,sizeof load,"%d%%",(int)(CpuPct(g_cpu.avg)+0.5f));
+  ui::printClipped(OLED_W-2-6*(int)strlen(load),2,30,load);   // callback load, right-aligned
   oled.setTextColor(SSD1306_WHITE);
 
   const int yRow1=14,yRow2=38; const int cellW_L=60,cellW_R=68,cellH=22;
@@ -385,6 +612,37 @@ static void drawPatchUi(bool btn_pressed,bool /*showTapFlag*/){
 
   oled.display();
 }
+
+// Power-up block-size picker (button held at boot): tap = next size,
+// hold = start. Shows the per-block latency.
+static size_t selectBlockSize(size_t cur){
+  const int N=sizeof(kBlockSizes)/sizeof(kBlockSizes[0]);
+  int idx=0; for(int i=0;i<N;i++) if(kBlockSizes[i]==cur) idx=i;
+  auto draw=[&](){
+    char l1[24], l2[24];
+    snprintf(l1,sizeof l1,"%u samples",(unsigned)kBlockSizes[idx]);
+    snprintf(l2,sizeof l2,"%.2f ms / block",1000.f*kBlockSizes[idx]/samplerate);
+    oled.clearDisplay(); oled.setTextSize(1);
+    oled.fillRect(0,0,OLED_W,12,SSD1306_WHITE); oled.setTextColor(SSD1306_BLACK);
+    ui::printClipped(2,2,OLED_W-4,"Audio Block");
+    oled.setTextColor(SSD1306_WHITE);
+    ui::printClipped(4,20,OLED_W-8,l1);
+    ui::printClipped(4,32,OLED_W-8,l2);
+    ui::printClipped(4,52,OLED_W-8,"tap:next hold:go");
+    oled.display();
+  };
+  draw();
+  while(digitalRead(PIN_BTN)==LOW) delay(5);   // release the boot press
+  for(;;){
+    while(digitalRead(PIN_BTN)==HIGH) delay(5);
+    delay(BTN_DEBOUNCE_MS);
+    uint32_t t0=millis();
+    while(digitalRead(PIN_BTN)==LOW){ if(millis()-t0>=BTN_LONG_MS) break; delay(5); }
+    if(millis()-t0>=BTN_LONG_MS){ while(digitalRead(PIN_BTN)==LOW) delay(5); return kBlockSizes[idx]; }
+    delay(BTN_DEBOUNCE_MS);
+    idx=(idx+1)%N; draw();
+  }
+}
 } // namespace ui
 
 // ================== SETUP / LOOP ==================
@@ -395,25 +653,27 @@ void setup(){
   pinMode(PIN_BTN,INPUT_PULLUP); pinMode(PIN_LED,OUTPUT);
   if(!oled.begin(SSD1306_SWITCHCAPVCC, OLED_ADDR)){ for(;;){ digitalWrite(PIN_LED,!digitalRead(PIN_LED)); delay(150);} }
   oled.dim(true); oled.ssd1306_command(SSD1306_SETCONTRAST); oled.ssd1306_command(UI_LOW_CONTRAST);
+  if(digitalRead(PIN_BTN)==LOW) g_block_size=ui::selectBlockSize(g_block_size);
 
-  verb.Init(samplerate);
-  preL_A2.Init(); preR_A2.Init();
-  preL_A3.Init(); preR_A3.Init();
-  a3mL.Init(); a3mR.Init();
-  shifter.Init(samplerate); shifter.SetTransposition(12.f);
-
-  dlyL.Init(); dlyR.Init();
+  EngineInit(eng[0]); EngineInit(eng[1]);
 
   oplpL.SetCutoff(OUT_LPF_HZ,samplerate); oplpR.SetCutoff(OUT_LPF_HZ,samplerate);
 
   // runtime inits
-  a3_phR=0.5f;
   toP2.eps_on=0.015f; toP2.eps_off=0.030f; toP2.cv_mode=false;
   toP3.eps_on=0.015f; toP3.eps_off=0.030f; toP3.cv_mode=false;
   dcL.R=dcR.R=0.995f; dcL.x1=dcL.y1=dcR.x1=dcR.y1=0.f;
   level=LEVEL_PATCH; bankSel=BANK_A; patchIdx=0; previewBank=BANK_A;
+  EngineStart(eng[0],bankSel,patchIdx); g_live=0;
 
   ui::drawBankMenu(previewBank); g_last_user_ms = millis();
+  CycleCounterInit();
+  LfoTableInit();
+  BenchModulation();
+  CpuMeterReset(); g_cpu.budget=(float)SystemCoreClock*g_block_size/samplerate;
+  if(Serial) Serial.printf("[mfx] block %u samples (%.2f ms), budget %.0f cyc\n",
+                           (unsigned)g_block_size,1000.f*g_block_size/samplerate,g_cpu.budget);
+  DAISY.SetAudioBlockSize(g_block_size);
   DAISY.begin(AudioCallback);
 }
 
@@ -462,22 +722,54 @@ void loop(){
     if(btn_state){ btn_press_start_ms=ms; btn_long_fired=false; g_last_user_ms=ms; OledWake(); }
     else if(!btn_long_fired){
       if(level==LEVEL_BANK){ previewBank = (previewBank==BANK_A) ? BANK_B : BANK_A; }
-      else { patchIdx=(patchIdx+1)%4; ResetFxForBankPatch(); }
+      else { patchIdx=(patchIdx+1)%4; RequestPatchChange(); }
       g_last_user_ms=ms; OledWake();
     }
   }
   if(btn_state && !btn_long_fired && (ms-btn_press_start_ms>=BTN_LONG_MS)){
     btn_long_fired=true;
-    if(level==LEVEL_BANK){ bankSel=previewBank; patchIdx=0; ResetFxForBankPatch(); level=LEVEL_PATCH; }
+    if(level==LEVEL_BANK){ bankSel=previewBank; patchIdx=0; RequestPatchChange(); level=LEVEL_PATCH; }
     else { previewBank=bankSel; level=LEVEL_BANK; }
     g_last_user_ms=ms; OledWake();
   }
 
+  // Serial: 'i' cycles the modulated-delay interpolation, 'r' resets the CPU maxima
+  if(Serial && Serial.available()>0){
+    int c=Serial.read();
+    if(c=='i'){
+      g_mod_interp=(uint8_t)((g_mod_interp+1)%INTERP_COUNT);
+      Serial.printf("[mfx] mod interp: %s\n",kInterpName[g_mod_interp]);
+    } else if(c=='r'){
+      CpuMeterReset(); Serial.println("[mfx] cpu maxima reset");
+    }
+  }
+
+  // Background re-init of a retired engine
+  EngineService();
+
+  // CPU report (serial): load as % of the block budget; peak is since the
+  // last report, per-patch maxima since boot or 'r' ("--" = not run yet)
+  static uint32_t last_report=0;
+  if(Serial && ms-last_report>=2000){
+    last_report=ms;
+    uint32_t peak=g_cpu.peak; g_cpu.peak=0;
+    float avg=g_cpu.avg;
+    Serial.printf("[mfx] %s blk %u: avg %.1f%% peak %.1f%% (%.0f cyc/smp) |",
+                  ui::patchTitleShort(), (unsigned)g_block_size, CpuPct(avg), CpuPct((float)peak),
+                  avg/g_block_size);
+    for(int b=0;b<2;b++) for(int p=0;p<4;p++){
+      uint32_t m=g_cpu.patchMax[b][p];
+      if(m) Serial.printf(" %c%d %.0f%%",'A'+b,p+1,CpuPct((float)m)); else Serial.printf(" %c%d --",'A'+b,p+1);
+    }
+    Serial.println();
+  }
+
   // Event-driven UI
   static uint32_t last_draw=0;
   static float p1_last=-1.f,p2_last=-1.f,p3_last=-1.f;
   static int patch_last=-1; static Bank bank_last=(Bank)255, preview_last=(Bank)255;
   static UiLevel level_last=(UiLevel)255;
+  static int load_last=-1;
   bool showTap=(bankSel==BANK_B)&&((nowTicks-last_tap_ms)<200);
 
   bool user_interaction = btn_state
@@ -488,8 +780,11 @@ void loop(){
   if(ms-g_last_user_ms>UI_IDLE_SLEEP_MS){ OledSleep(); }
 
   uint32_t min_frame = (ms-g_last_user_ms)<UI_ACTIVE_BOOST_MS ? UI_FRAME_MIN_MS_ACTIVE : UI_FRAME_MIN_MS_IDLE;
-  if(g_oled_awake && (ms-last_draw)>=min_frame && user_interaction){
-    last_draw=ms; p1_last=P1; p2_last=P2; p3_last=P3; patch_last=patchIdx; bank_last=bankSel; preview_last=previewBank; level_last=level;
+  // The load readout refreshes on its own (slowly) without counting as interaction
+  int load=(int)(CpuPct(g_cpu.avg)+0.5f);
+  bool load_refresh = level==LEVEL_PATCH && load!=load_last && (ms-last_draw)>=UI_LOAD_REFRESH_MS;
+  if(g_oled_awake && (ms-last_draw)>=min_frame && (user_interaction || load_refresh)){
+    last_draw=ms; load_last=load; p1_last=P1; p2_last=P2; p3_last=P3; patch_last=patchIdx; bank_last=bankSel; preview_last=previewBank; level_last=level;
     if(level==LEVEL_BANK) ui::drawBankMenu(previewBank); else ui::drawPatchUi(btn_state,showTap);
   }
 }
\ No newline at end of file
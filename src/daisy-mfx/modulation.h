@@ -0,0 +1,106 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+
+// Modulation building blocks: a phase-accumulator LFO (wavetable sine,
+// triangle, smoothed random) and a short delay line whose read interpolation
+// is chosen per block (linear / Hermite cubic / first-order allpass).
+//
+// Both are plain structs with Init() and no constructor work, and all-zero
+// bytes is a valid (silent) state, so they can live in DSY_SDRAM_BSS.
+
+// ---------------- LFO ----------------
+enum LfoShape : uint8_t { LFO_SINE, LFO_TRI, LFO_RANDOM };
+
+static const int LFO_TABLE_BITS = 8;
+static const int LFO_TABLE_SIZE = 1 << LFO_TABLE_BITS;
+extern float g_lfoSine[LFO_TABLE_SIZE + 1];   // one period + guard point
+
+// Fill the sine table; call once at boot.
+inline void LfoTableInit(){
+  for(int i=0;i<=LFO_TABLE_SIZE;i++) g_lfoSine[i]=sinf(6.28318531f*i/LFO_TABLE_SIZE);
+}
+
+// 32-bit phase accumulator: wraps for free, no fmod/branch. Output -1..1.
+struct Lfo {
+  uint32_t phase, inc;
+  uint8_t  shape;
+  uint32_t rng;          // LFO_RANDOM: xorshift state
+  float    ra, rb;       // LFO_RANDOM: segment start/end values
+
+  void Init(float sr, float hz, LfoShape s, float phase01=0.f, uint32_t seed=0x9E3779B9u){
+    shape=s; SetFreq(sr,hz); phase=(uint32_t)(phase01*4294967296.f);
+    rng=seed ? seed : 1u; ra=0.f; rb=NextRandom();
+  }
+  void SetFreq(float sr, float hz){ inc=(uint32_t)(hz/sr*4294967296.f); }
+
+  inline float Process(){
+    uint32_t p=phase; phase+=inc;
+    switch(shape){
+      case LFO_SINE:{
+        uint32_t i=p>>(32-LFO_TABLE_BITS);
+        float f=(p<<LFO_TABLE_BITS)*(1.f/4294967296.f);
+        return g_lfoSine[i]+f*(g_lfoSine[i+1]-g_lfoSine[i]);
+      }
+      case LFO_TRI:{
+        // u = phase + 3/4 turn, so the triangle starts at 0 rising like the sine
+        float u=(uint32_t)(p+0xC0000000u)*(1.f/4294967296.f);
+        return 4.f*fabsf(u-0.5f)-1.f;
+      }
+      default:{
+        // New random target every cycle, smoothstep between the two
+        float f=p*(1.f/4294967296.f);
+        float y=ra+(rb-ra)*f*f*(3.f-2.f*f);
+        if(phase<p){ ra=rb; rb=NextRandom(); }   // wrapped: next segment
+        return y;
+      }
+    }
+  }
+
+  inline float NextRandom(){
+    rng^=rng<<13; rng^=rng>>17; rng^=rng<<5;
+    return (int32_t)rng*(1.f/2147483648.f);
+  }
+};
+
+// ---------------- Modulated delay ----------------
+enum Interp : uint8_t { INTERP_LINEAR, INTERP_HERMITE, INTERP_ALLPASS, INTERP_COUNT };
+static const char* const kInterpName[INTERP_COUNT] = { "linear", "hermite", "allpass" };
+
+// One write head, one interpolated read head. Read before writing the current
+// input (as with DelayLine): delay 1 is the last sample written. Delays are
+// in samples and must stay within [2, LEN-3] (Hermite reads one sample either
+// side).
+template<size_t LEN>
+struct ModDelay {
+  static_assert((LEN & (LEN - 1)) == 0, "LEN must be a power of two");
+  float    buf[LEN];
+  uint32_t w;            // next write position
+  float    apY;          // allpass output history
+
+  void Reset(){ for(size_t i=0;i<LEN;i++) buf[i]=0.f; w=0; apY=0.f; }
+  inline void Write(float x){ buf[w]=x; w=(w+1)&(LEN-1); }
+
+  template<Interp M> inline float Read(float d){
+    const uint32_t m=LEN-1;
+    if(M==INTERP_ALLPASS){
+      // First-order allpass (Thiran): integer part chosen so the fractional
+      // part stays in [0.5, 1.5), where the coefficient is well-behaved.
+      int32_t di=(int32_t)(d-0.5f); float frac=d-(float)di;
+      float eta=(1.f-frac)/(1.f+frac);
+      float x0=buf[(w-di)&m], x1=buf[(w-1-di)&m];
+      apY=x1+eta*(x0-apY);
+      return apY;
+    }
+    int32_t di=(int32_t)d; float f=d-(float)di;
+    float x0=buf[(w-di)&m], x1=buf[(w-1-di)&m];
+    if(M==INTERP_LINEAR) return x0+f*(x1-x0);
+    // 4-point, 3rd-order Hermite (Catmull-Rom)
+    float xm1=buf[(w+1-di)&m], x2=buf[(w-2-di)&m];
+    float c1=0.5f*(x1-xm1);
+    float c2=xm1-2.5f*x0+2.f*x1-0.5f*x2;
+    float c3=0.5f*(x2-xm1)+1.5f*(x0-x1);
+    return ((c3*f+c2)*f+c1)*f+x0;
+  }
+};
@@ -0,0 +1,81 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Stereo multitap delay: one write head, up to MAX_TAPS read taps, rendered a
+// block at a time. Each tap has a level, pan, one-pole LP (tone), and a
+// feedback send back into the write head (straight or L/R crossed).
+//
+// Taps are read tap-major: a tap walks its own contiguous stretch of the
+// (interleaved L/R) buffer for the whole block, so SDRAM is read in cache
+// lines instead of 2 × taps scattered reads per sample. Tap delays are set
+// per block and ramped linearly across it. Every delay is kept longer than
+// the block, so a block never reads its own writes and the feedback sum can
+// be written after all taps are read.
+//
+// No constructor work and all-zero bytes is a valid empty state (no taps,
+// silent buffer), so it can live in DSY_SDRAM_BSS and be cleared by memset.
+template<size_t LEN, int MAX_TAPS, size_t MAX_BLOCK = 256>
+class MultiTapDelay {
+  static_assert((LEN & (LEN - 1)) == 0, "LEN must be a power of two");
+public:
+  struct Tap {
+    float delay;        // samples (block-end target)
+    float level, pan;   // pan -1..1 (constant-sum, as the original B3 taps)
+    float tone;         // one-pole LP coeff, 1 = open
+    float fb;           // feedback send into the write head
+    bool  cross;        // feed back L→R / R→L
+  };
+
+  void Reset(){ memset(this, 0, sizeof(*this)); }
+  void SetTapCount(int n){ ntaps_ = n < 0 ? 0 : (n > MAX_TAPS ? MAX_TAPS : n); }
+  int  TapCount() const { return ntaps_; }
+  Tap& tap(int i){ return cfg_[i]; }
+
+  // n ≤ MAX_BLOCK. outL/outR are overwritten.
+  void Process(const float* inL, const float* inR, float* outL, float* outR, size_t n){
+    const uint32_t M = LEN - 1;
+    const float dMin = (float)(MAX_BLOCK + 1), dMax = (float)(LEN - 2);
+    float fbL[MAX_BLOCK], fbR[MAX_BLOCK];
+    for(size_t i=0;i<n;i++){ outL[i]=outR[i]=fbL[i]=fbR[i]=0.f; }
+
+    for(int t=0;t<ntaps_;t++){
+      const Tap& c=cfg_[t]; TapState& s=st_[t];
+      float d1 = c.delay < dMin ? dMin : (c.delay > dMax ? dMax : c.delay);
+      if(!s.init){ s.d=d1; s.init=true; }
+      float d=s.d, dd=(d1-s.d)/n; s.d=d1;
+      float gL=c.level*((c.pan<=0.f)?1.f:(1.f-c.pan));
+      float gR=c.level*((c.pan>=0.f)?1.f:(1.f+c.pan));
+      float* fA = c.cross ? fbR : fbL;   // where this tap's L feeds back
+      float* fB = c.cross ? fbL : fbR;
+      float a=c.tone, g=c.fb, lpL=s.lpL, lpR=s.lpR;
+      for(size_t i=0;i<n;i++){
+        uint32_t di=(uint32_t)d; float fr=d-(float)di;
+        const float* x0=buf_[(w_+i-di)&M];      // delay di
+        const float* x1=buf_[(w_+i-di-1)&M];    // delay di+1
+        float yL=x0[0]+fr*(x1[0]-x0[0]);
+        float yR=x0[1]+fr*(x1[1]-x0[1]);
+        lpL+=a*(yL-lpL); lpR+=a*(yR-lpR);
+        outL[i]+=lpL*gL; outR[i]+=lpR*gR;
+        fA[i]+=lpL*g;    fB[i]+=lpR*g;
+        d+=dd;
+      }
+      s.lpL=lpL; s.lpR=lpR;
+    }
+
+    for(size_t i=0;i<n;i++){
+      float* f=buf_[(w_+i)&M];
+      f[0]=inL[i]+fbL[i]; f[1]=inR[i]+fbR[i];
+    }
+    w_=(w_+n)&M;
+  }
+
+private:
+  struct TapState { float d, lpL, lpR; bool init; };
+  float buf_[LEN][2];     // interleaved L/R frames
+  uint32_t w_;            // next frame to write
+  int ntaps_;
+  Tap cfg_[MAX_TAPS];
+  TapState st_[MAX_TAPS];
+};
@@ -0,0 +1,88 @@
+#include "ads1115_async.h"
+
+#define ADS_REG_CONV  0x00
+#define ADS_REG_CFG   0x01
+#define ADS_REG_LO    0x02
+#define ADS_REG_HI    0x03
+
+volatile bool Ads1115Async::rdy_ = false;
+
+void Ads1115Async::rdyIsr() { rdy_ = true; }
+
+bool Ads1115Async::writeReg(uint8_t reg, uint16_t v) {
+    wire_->beginTransmission(addr_);
+    wire_->write(reg);
+    wire_->write((uint8_t)(v >> 8));
+    wire_->write((uint8_t)(v & 0xFF));
+    return wire_->endTransmission() == 0;
+}
+
+bool Ads1115Async::readConv(int16_t& out) {
+    wire_->beginTransmission(addr_);
+    wire_->write(ADS_REG_CONV);
+    if (wire_->endTransmission(false) != 0) return false;
+    if (wire_->requestFrom((int)addr_, 2) != 2) return false;
+    uint8_t msb = wire_->read();
+    uint8_t lsb = wire_->read();
+    out = (int16_t)((uint16_t(msb) << 8) | lsb);
+    return true;
+}
+
+bool Ads1115Async::start(uint8_t ch) {
+    // OS=1 start, MUX=100+ch (AINch vs GND), PGA=001 (±4.096V), MODE=1
+    // single-shot, DR=111 (860 SPS). COMP_QUE=00 turns ALERT/RDY into a
+    // conversion-ready output (with the threshold setup in begin());
+    // without the pin it stays 11, comparator off.
+    uint16_t que = (rdyPin_ >= 0) ? 0x0000 : 0x0003;
+    uint16_t cfg = 0x8000 | (uint16_t(0b100 + ch) << 12) | 0x0200 | 0x0100 | 0x00E0 | que;
+    rdy_ = false;
+    if (!writeReg(ADS_REG_CFG, cfg)) return false;
+    startUs_ = micros();
+    return true;
+}
+
+bool Ads1115Async::begin(TwoWire& wire, uint8_t addr, int rdyPin) {
+    wire_ = &wire; addr_ = addr; rdyPin_ = rdyPin;
+    busy_ = false; ch_ = 0;
+    if (rdyPin_ >= 0) {
+        // Hi_thresh MSB = 1, Lo_thresh MSB = 0 selects conversion-ready mode
+        if (!writeReg(ADS_REG_HI, 0x8000) || !writeReg(ADS_REG_LO, 0x0000)) {
+            rdyPin_ = -1;   // device absent or unhappy: fall back to timing
+        } else {
+            pinMode(rdyPin_, INPUT_PULLUP);
+            attachInterrupt(digitalPinToInterrupt(rdyPin_), rdyIsr, FALLING);
+        }
+    }
+    busy_ = start(ch_);
+    if (!busy_) { errors_++; retryUs_ = micros(); }
+    return busy_;
+}
+
+bool Ads1115Async::poll() {
+    if (!wire_) return false;
+    uint32_t now = micros();
+    if (!busy_) {
+        // Last transfer failed: retry without hammering a missing device
+        if (now - retryUs_ < 10000) return false;
+        busy_ = start(ch_);
+        if (!busy_) { errors_++; retryUs_ = now; }
+        return false;
+    }
+    uint32_t waited = now - startUs_;
+    bool done = (rdyPin_ >= 0) ? (rdy_ || waited >= RDY_TIMEOUT_US) : waited >= CONV_US;
+    if (!done) return false;
+
+    int16_t v;
+    bool ok = readConv(v);
+    if (ok) {
+        value_[ch_] = v;
+        stamp_[ch_] = startUs_ + CONV_US / 2;
+        conversions_++;
+    } else {
+        errors_++;
+    }
+    ch_ = (ch_ + 1) % CHANNELS;
+    busy_ = start(ch_);
+    if (!busy_) { errors_++; retryUs_ = now; }
+    return ok;
+}
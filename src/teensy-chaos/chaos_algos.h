@@ -0,0 +1,1060 @@
+#pragma once
+#include <stdint.h>
+#include <math.h>
+#include "chaos_dsp.h"
+#include "chaos_systems.h"
+#include "chaos_integrators.h"
+#include "chaos_poly.h"
+#include "chaos_maps.h"
+
+// The chaos algorithms: ChaosBase, the block renderers and every algorithm
+// class. No Arduino dependencies, so the host tool (src/chaos-host) builds
+// exactly what the firmware runs. The audio engine, registry and UI stay in
+// main.cpp.
+#ifndef AUDIO_BLOCK_SAMPLES
+#define AUDIO_BLOCK_SAMPLES 128     // Teensy Audio Library block
+#endif
+
+// ─── ChaosBase ────────────────────────────────────────────────────────────────
+// Abstract base for all chaotic algorithms. Subclasses populate metadata fields
+// in their constructors, implement init/setParams/getX/getY plus a non-virtual
+// step(h), state() and kDim, and derive through ChaosBlock<> which supplies
+// renderBlock(). setParams() stores the per-output-sample step in dt_.
+//
+// Parameters cross from loop() to the audio ISR as whole ChaosParams blocks:
+// loop() calls post(), renderBlock() takes the newest block once at block
+// start and ramps towards it, calling setParams() itself. setParams() is
+// therefore only ever called from the audio ISR.
+#ifndef CHAOS_OVERSAMPLE
+#define CHAOS_OVERSAMPLE 0      // 0 = adaptive, else fixed 1 / 2 / 4 / 8
+#endif
+#ifndef CHAOS_ADAPT_TOL
+#define CHAOS_ADAPT_TOL 1.0e-4f // adaptive: max relative step-doubling error per step
+#endif
+static constexpr uint8_t OS_ADAPTIVE = 0, OS_MAX = 8;
+
+struct ChaosParams { float chaos, rate, charV; };
+
+// CV output stream: renderBlock() taps the algorithm's cvX()/cvY() every
+// CHAOS_CV_DIV output samples (4.41 kHz by default); the engine queues the
+// taps for the CV timer. The phase carries across blocks, so taps stay
+// evenly spaced in audio time.
+#ifndef CHAOS_CV_DIV
+#define CHAOS_CV_DIV 10
+#endif
+static_assert(CHAOS_CV_DIV >= 4 && CHAOS_CV_DIV <= 64, "CV rate must stay within ~0.7-11 kHz");
+struct CvTap {
+    static constexpr int MAX = AUDIO_BLOCK_SAMPLES / CHAOS_CV_DIV + 1;
+    uint8_t phase = 0;
+    uint8_t n = 0;                  // taps in this block
+    float   x[MAX], y[MAX];
+    inline bool due() { if (++phase < CHAOS_CV_DIV) return false; phase = 0; return true; }
+};
+
+class ChaosBase {
+public:
+    const char* name       = "?";
+    const char* chaosLabel = "c";   // display label for CHAOS param
+    const char* charLabel  = "a";   // display label for CHAR param
+    const char* integName  = "";    // integrator (chaos_integrators.h)
+    float chaosMin = 0.0f,   chaosMax = 1.0f;
+    float rateMin  = 0.001f, rateMax  = 0.1f;
+    float charMin  = 0.0f,   charMax  = 1.0f;
+    float modScale = 1.0f;          // chaos-param units per volt of MOD CV
+    float gainL    = 0.12f, gainR = 0.12f;  // pre-tanh amplitude scale
+    float xMin = -1.0f, xRange = 2.0f;     // plot window
+    float yMin = -1.0f, yRange = 2.0f;
+    float cvScaleX = 0.5f, cvScaleY = 0.5f; // state → ±5V CV
+    bool  isMap    = false;         // iterated map (MapBlock): RATE = iterates/sample
+    // Auto-normalised: the engine tracks X/Y ranges (audio ISR) and maps
+    // them to ±1, so gainL/R and cvScaleX/Y apply to the normalised signal
+    // and the plot window follows the range instead of xMin/xRange.
+    bool  autoNorm = false;
+    AutoRange rangeX, rangeY;
+    // Line-in forcing: derivative units per full-scale input, injected by the
+    // field's u term (chaos_systems.h). 0 = algorithm takes no forcing.
+    float forceGain = 0.0f;
+    // Times a divergence guard in step() put the state back to init()
+    volatile uint32_t guardResets = 0;
+
+    // Audio-block cost (render + output stage), written by the audio ISR.
+    // osCycles[k] is the last block rendered at 2^k oversampling.
+    volatile uint32_t blockCycles = 0, blockCyclesMax = 0;
+    volatile uint32_t osCycles[4] = {0, 0, 0, 0};
+    volatile uint8_t  osUsed = 1;   // factor of the last block
+
+    virtual ~ChaosBase() {}
+    virtual void  init()                                          = 0;
+    virtual void  setParams(float chaos, float rate, float charV) = 0;
+    // n output samples → X/Y, plus CV taps appended to cv; osMode 1/2/4/8
+    // or OS_ADAPTIVE. u[n] is the forcing input, already scaled by forceGain
+    // (zeros when off), held across each output sample. Returns the factor used.
+    virtual uint8_t renderBlock(const float* u, float* xs, float* ys, int n, uint8_t osMode, CvTap& cv) = 0;
+    virtual float getX() const                                    = 0;
+    virtual float getY() const                                    = 0;
+    // Signals for the X/Y CV jacks; the same as the audio pair unless overridden
+    virtual float cvX() const { return getX(); }
+    virtual float cvY() const { return getY(); }
+    // RATE in effect: time per output sample (flows, after any
+    // algorithm-specific cap) or iterates per output sample (maps)
+    float stepSize() const { return dt_; }
+
+    // Control side: publish a complete parameter block. Double buffer: the
+    // block is written to the slot the ISR isn't reading, then the index
+    // flips. The ISR can preempt post() but not the reverse, so its copy in
+    // takeParams() is never torn.
+    void post(const ChaosParams& p) {
+        uint8_t w = pubIdx_ ^ 1;
+        params_[w] = p;
+        __asm__ volatile("" ::: "memory");   // slot written before the flip
+        pubIdx_ = w;
+        posted_ = true;
+    }
+
+protected:
+    // Divergence guards call this instead of init() so resets are counted
+    void guardReset() { guardResets++; init(); }
+
+    // Audio side: newest published block; false if nothing posted yet
+    bool takeParams(ChaosParams& p) const {
+        if (!posted_) return false;
+        p = params_[pubIdx_];
+        return true;
+    }
+
+    // Parameter smoothing for the block renderers: CHAOS and CHAR ramp
+    // linearly, RATE geometrically (it sets pitch, so equal ratios per sample
+    // sound even), from where the last block ended to the newest posted
+    // block across this block. rampBegin() returns RAMP_NONE (nothing new),
+    // RAMP_SNAP (first block: apply rampCur_ once) or RAMP_RUN (call
+    // rampStep() and apply rampCur_ before every output sample).
+    enum : uint8_t { RAMP_NONE, RAMP_SNAP, RAMP_RUN };
+    uint8_t rampBegin(int n) {
+        ChaosParams tgt;
+        if (!takeParams(tgt)) return RAMP_NONE;
+        if (!rampApplied_) { rampCur_ = tgt; rampApplied_ = true; return RAMP_SNAP; }
+        if (tgt.chaos == rampCur_.chaos && tgt.rate == rampCur_.rate && tgt.charV == rampCur_.charV) return RAMP_NONE;
+        const float inv = 1.0f / n;
+        dChaos_ = (tgt.chaos - rampCur_.chaos) * inv;
+        dChar_  = (tgt.charV - rampCur_.charV) * inv;
+        kRate_  = (rampCur_.rate > 0.0f && tgt.rate > 0.0f) ? powf(tgt.rate / rampCur_.rate, inv) : 1.0f;
+        rampEnd_ = tgt;
+        rampLeft_ = n;
+        return RAMP_RUN;
+    }
+    inline void rampStep() {
+        if (--rampLeft_ <= 0) rampCur_ = rampEnd_;   // land exactly, no drift
+        else { rampCur_.chaos += dChaos_; rampCur_.charV += dChar_; rampCur_.rate *= kRate_; }
+    }
+
+    float dt_ = 0.05f;              // integration time per output sample
+    ChaosParams rampCur_ = {};
+
+private:
+    ChaosParams rampEnd_ = {};
+    float dChaos_ = 0.0f, dChar_ = 0.0f, kRate_ = 1.0f;
+    int rampLeft_ = 0;
+    bool rampApplied_ = false;
+    ChaosParams params_[2] = {};
+    volatile uint8_t pubIdx_ = 0;
+    volatile bool posted_ = false;
+};
+
+// ─── ChaosBlock ───────────────────────────────────────────────────────────────
+// Supplies renderBlock() for Derived: one virtual call per audio block, with
+// Derived::force()/step()/getX()/getY() inlined into the loop. Derived must
+// be final so the getX()/getY() calls resolve statically. force(u) sets the
+// field's forcing term once per output sample.
+//
+// Oversampling runs os steps of dt_/os per output sample and brings X/Y back
+// to the audio rate through a half-band cascade (chaos_dsp.h), so fast
+// settings neither alias nor take steps too large to stay stable. Adaptive
+// mode picks os per block by step doubling from the current state: double
+// it while the error is above CHAOS_ADAPT_TOL, halve it once the error
+// drops under 1/32 of the tolerance (one halving of h for RK4).
+template <class Derived>
+class ChaosBlock : public ChaosBase {
+public:
+    uint8_t renderBlock(const float* u, float* xs, float* ys, int n, uint8_t osMode, CvTap& cv) override {
+        Derived& d = static_cast<Derived&>(*this);
+        bool ramp = beginRamp(d, n);
+        uint8_t os = osMode ? osMode : adaptOs(d);
+        if (os != osLast_) {
+            // Prime the filters at the current output so a switch doesn't click
+            decX_.reset(d.getX()); decY_.reset(d.getY());
+            osLast_ = os;
+        }
+        if (os == 1) {
+            for (int i = 0; i < n; i++) {
+                if (ramp) rampStep(d);
+                d.force(u[i]);
+                d.step(dt_);
+                xs[i] = d.getX();
+                ys[i] = d.getY();
+                if (cv.due()) tapCv(d, cv);
+            }
+            return 1;
+        }
+        for (int base = 0; base < n; base += kChunk) {
+            int m = (n - base < kChunk) ? n - base : kChunk;
+            int len = m * os;
+            for (int j = 0, i = 0; j < m; j++) {
+                if (ramp) rampStep(d);
+                d.force(u[base + j]);
+                const float h = dt_ / os;
+                for (int k = 0; k < os; k++, i++) {
+                    d.step(h);
+                    bufX_[i] = d.getX();
+                    bufY_[i] = d.getY();
+                }
+                if (cv.due()) tapCv(d, cv);
+            }
+            decX_.run(bufX_, len, os);
+            decY_.run(bufY_, len, os);
+            for (int i = 0; i < m; i++) { xs[base + i] = bufX_[i]; ys[base + i] = bufY_[i]; }
+        }
+        return os;
+    }
+
+private:
+    static constexpr int kChunk = 16;   // output samples per oversampled chunk
+
+    static inline void tapCv(Derived& d, CvTap& cv) {
+        if (cv.n < CvTap::MAX) { cv.x[cv.n] = d.cvX(); cv.y[cv.n] = d.cvY(); cv.n++; }
+    }
+
+    bool beginRamp(Derived& d, int n) {
+        uint8_t r = rampBegin(n);
+        if (r == RAMP_SNAP) applyParams(d);
+        return r == RAMP_RUN;
+    }
+    inline void rampStep(Derived& d) { ChaosBase::rampStep(); applyParams(d); }
+    inline void applyParams(Derived& d) { d.setParams(rampCur_.chaos, rampCur_.rate, rampCur_.charV); }
+
+    uint8_t adaptOs(Derived& d) {
+        constexpr int N = Derived::kDim;
+        float* s = d.state();
+        float s0[N], full[N];
+        for (int k = 0; k < N; k++) s0[k] = s[k];
+        // Trial steps are thrown away, so a guard they trip isn't a real reset
+        const uint32_t resets0 = guardResets;
+        const float h = dt_ / osAdapt_;
+        d.step(h);
+        for (int k = 0; k < N; k++) { full[k] = s[k]; s[k] = s0[k]; }
+        d.step(0.5f * h); d.step(0.5f * h);
+        float err = 0.0f;
+        for (int k = 0; k < N; k++) {
+            float e = fabsf(full[k] - s[k]) / (1.0f + fabsf(s[k]));
+            if (!(e <= err)) err = e;   // NaN counts as worst
+            s[k] = s0[k];
+        }
+        guardResets = resets0;
+        if (!(err <= CHAOS_ADAPT_TOL)) { if (osAdapt_ < OS_MAX) osAdapt_ <<= 1; }
+        else if (err < CHAOS_ADAPT_TOL * (1.0f / 32.0f) && osAdapt_ > 1) osAdapt_ >>= 1;
+        return osAdapt_;
+    }
+
+    OversampleDecimator decX_, decY_;
+    float bufX_[kChunk * OS_MAX], bufY_[kChunk * OS_MAX];
+    uint8_t osLast_ = 1, osAdapt_ = 1;
+};
+
+// ─── MapBlock ─────────────────────────────────────────────────────────────────
+// renderBlock() for the iterated maps. RATE (dt_) is map iterates per output
+// sample, so the map runs at its own rate rather than the sample rate: a
+// phase accumulator iterates whenever it wraps. Between iterates X and Y are
+// interpolated from their last four values: hold, linear, or 4-point cubic
+// Hermite. Linear and cubic smooth the stair-step and suppress its images.
+// Every mode lags by the same two iterates, so switching doesn't jump.
+// Derived (final) provides iterate(), mapX(), mapY() and setParams(), plus
+// state()/kDim for tools.
+#ifndef CHAOS_MAP_INTERP
+#define CHAOS_MAP_INTERP 2      // 0 hold, 1 linear, 2 cubic
+#endif
+enum : uint8_t { INTERP_HOLD, INTERP_LINEAR, INTERP_CUBIC, INTERP_COUNT };
+static const char* const kInterpName[INTERP_COUNT] = {"hld", "lin", "cub"};
+static volatile uint8_t mapInterp = CHAOS_MAP_INTERP;   // shared by all maps
+
+template <class Derived>
+class MapBlock : public ChaosBase {
+public:
+    uint8_t renderBlock(const float*, float* xs, float* ys, int n, uint8_t, CvTap& cv) override {
+        Derived& d = static_cast<Derived&>(*this);
+        uint8_t r = rampBegin(n);
+        if (r == RAMP_SNAP) applyParams(d);
+        const uint8_t mode = mapInterp;
+        for (int i = 0; i < n; i++) {
+            if (r == RAMP_RUN) { rampStep(); applyParams(d); }
+            phase_ += dt_;
+            for (int k = 0; phase_ >= 1.0f && k < kMaxIter; k++) { phase_ -= 1.0f; advance(d); }
+            if (phase_ >= 1.0f) phase_ -= floorf(phase_);   // above kMaxIter per sample: skip
+            x_ = interp(hx_, phase_, mode);
+            y_ = interp(hy_, phase_, mode);
+            xs[i] = x_; ys[i] = y_;
+            if (cv.due() && cv.n < CvTap::MAX) { cv.x[cv.n] = d.cvX(); cv.y[cv.n] = d.cvY(); cv.n++; }
+        }
+        return 1;
+    }
+    float getX() const override { return x_; }
+    float getY() const override { return y_; }
+
+protected:
+    // Fill the history with the current iterate (after the map's reset)
+    void primeHistory() {
+        Derived& d = static_cast<Derived&>(*this);
+        for (int k = 0; k < 4; k++) { hx_[k] = d.mapX(); hy_[k] = d.mapY(); }
+        x_ = hx_[1]; y_ = hy_[1]; phase_ = 0.0f;
+    }
+
+private:
+    static constexpr int kMaxIter = 4;  // iterates per output sample
+
+    inline void applyParams(Derived& d) { d.setParams(rampCur_.chaos, rampCur_.rate, rampCur_.charV); }
+
+    inline void advance(Derived& d) {
+        d.iterate();
+        hx_[0] = hx_[1]; hx_[1] = hx_[2]; hx_[2] = hx_[3]; hx_[3] = d.mapX();
+        hy_[0] = hy_[1]; hy_[1] = hy_[2]; hy_[2] = hy_[3]; hy_[3] = d.mapY();
+    }
+
+    // Segment h[1] → h[2] at t in [0, 1)
+    static inline float interp(const float* h, float t, uint8_t mode) {
+        if (mode == INTERP_HOLD) return h[1];
+        if (mode == INTERP_LINEAR) return h[1] + t * (h[2] - h[1]);
+        float c1 = 0.5f * (h[2] - h[0]);
+        float c2 = h[0] - 2.5f * h[1] + 2.0f * h[2] - 0.5f * h[3];
+        float c3 = 0.5f * (h[3] - h[0]) + 1.5f * (h[1] - h[2]);
+        return ((c3 * t + c2) * t + c1) * t + h[1];
+    }
+
+    float hx_[4] = {}, hy_[4] = {};
+    float x_ = 0.0f, y_ = 0.0f, phase_ = 0.0f;
+};
+
+// ─── Output scaling ───────────────────────────────────────────────────────────
+// Per-block gains from a rendered block to the output stage: audio pre-tanh
+// gain/offset and CV volts/offset. For autoNorm algorithms this is where the
+// tracked range folds in (one update per block, no per-sample division).
+struct OutputScale { float gL, gR, offL, offR, cvGX, cvGY; };
+inline OutputScale outputScale(ChaosBase& a, const float* xs, const float* ys, int n) {
+    OutputScale sc = { a.gainL, a.gainR, 0.0f, 0.0f, a.cvScaleX, a.cvScaleY };
+    if (a.autoNorm) {
+        a.rangeX.track(xs, n);
+        a.rangeY.track(ys, n);
+        sc.offL = a.rangeX.offset; sc.gL *= a.rangeX.scale; sc.cvGX *= a.rangeX.scale;
+        sc.offR = a.rangeY.offset; sc.gR *= a.rangeY.scale; sc.cvGY *= a.rangeY.scale;
+    }
+    return sc;
+}
+
+// ─── Integrator selection ─────────────────────────────────────────────────────
+// Per-algorithm integrator (Euler / Heun / RK4 / Symplectic, see
+// chaos_integrators.h). Override at build time, e.g. -DCHAOS_INTEG_LORENZ=Heun;
+// the integrator benchmark ('b' on serial) shows what each choice costs and drifts.
+#ifndef CHAOS_INTEG_ROSSLER
+#define CHAOS_INTEG_ROSSLER RK4
+#endif
+#ifndef CHAOS_INTEG_VANDERPOL
+#define CHAOS_INTEG_VANDERPOL RK4
+#endif
+#ifndef CHAOS_INTEG_LORENZ
+#define CHAOS_INTEG_LORENZ RK4
+#endif
+#ifndef CHAOS_INTEG_CHUA
+#define CHAOS_INTEG_CHUA RK4
+#endif
+#ifndef CHAOS_INTEG_DUFFING
+#define CHAOS_INTEG_DUFFING RK4
+#endif
+#ifndef CHAOS_INTEG_CPLROSSLER
+#define CHAOS_INTEG_CPLROSSLER RK4
+#endif
+#ifndef CHAOS_INTEG_POLY
+#define CHAOS_INTEG_POLY RK4
+#endif
+#ifndef CHAOS_INTEG_THOMAS
+#define CHAOS_INTEG_THOMAS RK4
+#endif
+#ifndef CHAOS_INTEG_AIZAWA
+#define CHAOS_INTEG_AIZAWA RK4
+#endif
+#ifndef CHAOS_INTEG_CHEN
+#define CHAOS_INTEG_CHEN RK4
+#endif
+#ifndef CHAOS_INTEG_HALVORSEN
+#define CHAOS_INTEG_HALVORSEN RK4
+#endif
+#ifndef CHAOS_INTEG_SPROTT
+#define CHAOS_INTEG_SPROTT RK4
+#endif
+
+// ─── ChaosRossler ─────────────────────────────────────────────────────────────
+// dx = -y - z,  dy = x + a*y,  dz = b + z*(x - c)
+// CHAOS = c (bifurcation, 2–8),  CHAR = a (spiral tightness, 0.1–0.4)
+class ChaosRossler final : public ChaosBlock<ChaosRossler> {
+public:
+    using Integ = CHAOS_INTEG_ROSSLER;
+    ChaosRossler() {
+        name       = "ROSSLER";   integName = Integ::name;
+        chaosLabel = "c"; charLabel = "a";
+        chaosMin   = 2.0f;   chaosMax = 8.0f;
+        rateMin    = 0.002f; rateMax  = 0.1f;
+        charMin    = 0.1f;   charMax  = 0.4f;
+        modScale   = 1.0f;
+        gainL      = 0.12f;  gainR    = 0.12f;
+        forceGain  = 1.0f;
+        xMin       = -11.0f; xRange   = 24.0f;
+        yMin       = -11.0f; yRange   = 22.0f;
+        dt_        = 0.05f;
+        cvScaleX   = 0.50f;  cvScaleY = 0.50f;
+    }
+    void init() override { s_[0] = 0.1f; s_[1] = 0.0f; s_[2] = 0.0f; }
+    void setParams(float chaos, float rate, float charV) override {
+        f_.c = chaos; dt_ = rate; f_.a = charV;
+    }
+    inline void step(float h) { Integ::step(f_, s_, h); }
+    inline void force(float u) { f_.u = u; }
+    static constexpr int kDim = 3;
+    float* state() { return s_; }
+    float getX() const override { return s_[0]; }
+    float getY() const override { return s_[1]; }
+private:
+    RosslerField f_;
+    float s_[3] = {0.1f, 0.0f, 0.0f};
+};
+
+// ─── ChaosVanDerPol ───────────────────────────────────────────────────────────
+// dx/dt = y,   dy/dt = mu*(1 - x^2)*y - x
+// CHAOS = mu (nonlinearity, 0.1–8): low = near-sine, high = relaxation osc
+// Start on limit cycle (x=2, y=0) so amplitude is correct from first sample.
+class ChaosVanDerPol final : public ChaosBlock<ChaosVanDerPol> {
+public:
+    using Integ = CHAOS_INTEG_VANDERPOL;
+    ChaosVanDerPol() {
+        name       = "VAN DER POL";   integName = Integ::name;
+        chaosLabel = "u"; charLabel = "a";
+        chaosMin   = 0.1f;   chaosMax = 8.0f;
+        rateMin    = 0.002f; rateMax  = 0.15f;
+        charMin    = 0.0f;   charMax  = 1.0f;  // reserved
+        modScale   = 1.0f;
+        gainL      = 0.45f;  gainR    = 0.20f;
+        forceGain  = 1.0f;
+        xMin       = -3.0f;  xRange   = 6.0f;
+        yMin       = -8.0f;  yRange   = 16.0f;
+        dt_        = 0.05f;
+        cvScaleX   = 2.00f;  cvScaleY = 0.60f;
+    }
+    void init() override { s_[0] = 2.0f; s_[1] = 0.0f; }
+    void setParams(float chaos, float rate, float charV) override {
+        f_.mu = chaos;
+        // Cap dt for numerical stability: VdP stiffness ∝ mu; RK4 diverges if dt*mu too large
+        dt_ = fminf(rate, 1.0f / (f_.mu + 2.0f));
+        (void)charV;
+    }
+    inline void step(float h) {
+        Integ::step(f_, s_, h);
+        // Safety net: reset if numerics diverge (edge case at extreme mu+dt)
+        if (!isfinite(s_[0]) || !isfinite(s_[1]) || fabsf(s_[0]) > 20.0f) {
+            guardReset();
+        }
+    }
+    inline void force(float u) { f_.u = u; }
+    static constexpr int kDim = 2;
+    float* state() { return s_; }
+    float getX() const override { return s_[0]; }
+    float getY() const override { return s_[1]; }
+private:
+    VanDerPolField f_;
+    float s_[2] = {2.0f, 0.0f};
+};
+
+// ─── ChaosLorenz ──────────────────────────────────────────────────────────────
+// dx = sigma*(y-x),  dy = x*(rho-z)-y,  dz = x*y - beta*z
+// CHAOS = rho (bifurcation, 24–32),  CHAR = sigma (8–14)
+// getY() returns z-rho (centred around 0) for both audio and plot.
+class ChaosLorenz final : public ChaosBlock<ChaosLorenz> {
+public:
+    using Integ = CHAOS_INTEG_LORENZ;
+    ChaosLorenz() {
+        name       = "LORENZ";   integName = Integ::name;
+        chaosLabel = "r"; charLabel = "s";
+        chaosMin   = 24.0f;  chaosMax = 32.0f;
+        rateMin    = 0.001f; rateMax  = 0.003f;
+        charMin    = 6.0f;   charMax  = 14.0f;
+        modScale   = 2.0f;
+        gainL      = 0.05f;  gainR    = 0.05f;
+        forceGain  = 20.0f;
+        xMin       = -20.0f; xRange   = 40.0f;
+        yMin       = -28.0f; yRange   = 55.0f;  // z-rho: ≈ -28 to +27
+        dt_        = 0.002f;
+        cvScaleX   = 0.25f;  cvScaleY = 0.15f;
+    }
+    void init() override { s_[0] = 0.1f; s_[1] = 0.0f; s_[2] = 0.0f; }
+    void setParams(float chaos, float rate, float charV) override {
+        f_.rho = chaos; dt_ = rate; f_.sigma = charV;
+    }
+    inline void step(float h) { Integ::step(f_, s_, h); }
+    inline void force(float u) { f_.u = u; }
+    static constexpr int kDim = 3;
+    float* state() { return s_; }
+    float getX() const override { return s_[0]; }
+    float getY() const override { return s_[2] - f_.rho; }  // centred: audio + plot
+private:
+    LorenzField f_;
+    float s_[3] = {0.1f, 0.0f, 0.0f};
+};
+
+// ─── ChaosChua ────────────────────────────────────────────────────────────────
+// Chua circuit — double-scroll attractor.
+// dx = alpha*(y - x - f(x)),  dy = x - y + z,  dz = -beta*y
+// f(x): piecewise-linear Chua diode, negative slope in centre region.
+// CHAOS = alpha (8–16),  CHAR = beta (20–35)
+// Audio: x→L, z→R  (y amplitude is tiny, ~±0.5, not suitable for audio)
+class ChaosChua final : public ChaosBlock<ChaosChua> {
+public:
+    using Integ = CHAOS_INTEG_CHUA;
+    ChaosChua() {
+        name       = "CHUA";   integName = Integ::name;
+        chaosLabel = "a"; charLabel = "b";
+        chaosMin   = 8.0f;   chaosMax = 11.0f;   // double-scroll bounded ~8.5–10.5
+        rateMin    = 0.001f; rateMax  = 0.008f;
+        charMin    = 12.0f;  charMax  = 16.0f;   // canonical 14.286 near centre
+        modScale   = 1.0f;
+        gainL      = 0.28f;  gainR    = 0.25f;
+        forceGain  = 0.5f;
+        xMin       = -5.0f;  xRange   = 10.0f;
+        yMin       = -6.0f;  yRange   = 12.0f;  // z axis for phase plot
+        dt_        = 0.005f;
+        cvScaleX   = 1.30f;  cvScaleY = 1.00f;
+    }
+    void init() override { s_[0] = 0.5f; s_[1] = 0.0f; s_[2] = 0.0f; }
+    void setParams(float chaos, float rate, float charV) override {
+        f_.alpha = chaos; dt_ = rate; f_.beta = charV;
+    }
+    inline void step(float h) {
+        Integ::step(f_, s_, h);
+        // Guard: reset if trajectory escapes the attractor
+        if (!isfinite(s_[0]) || !isfinite(s_[2]) || fabsf(s_[0]) > 8.0f) guardReset();
+    }
+    inline void force(float u) { f_.u = u; }
+    static constexpr int kDim = 3;
+    float* state() { return s_; }
+    float getX() const override { return s_[0]; }
+    float getY() const override { return s_[2]; }
+private:
+    ChuaField f_;
+    float s_[3] = {0.1f, 0.0f, 0.0f};
+};
+
+// ─── ChaosDuffing ─────────────────────────────────────────────────────────────
+// Forced nonlinear oscillator — double-well potential with periodic drive.
+// Autonomous 3-variable form: track phase φ = ω·t as a state variable.
+// dx = y,   dy = -δy - αx - βx³ + γcos(φ),   dφ = ω
+// α=-1, β=1 (double-well), δ=0.3 (damping) — fixed.
+// CHAOS = γ (drive amplitude, 0.1–0.8): low = periodic, high = chaotic
+// CHAR  = ω (drive frequency, 0.8–1.4): sets the base pitch
+// Audio: x→L, y→R. Frequency ≈ ω·dt·44100 / 2π Hz.
+class ChaosDuffing final : public ChaosBlock<ChaosDuffing> {
+public:
+    using Integ = CHAOS_INTEG_DUFFING;
+    ChaosDuffing() {
+        name       = "DUFFING";   integName = Integ::name;
+        chaosLabel = "g"; charLabel  = "w";
+        chaosMin   = 0.1f;   chaosMax = 0.8f;
+        rateMin    = 0.005f; rateMax  = 0.10f;
+        charMin    = 0.8f;   charMax  = 1.4f;
+        modScale   = 0.35f;
+        gainL      = 0.55f;  gainR    = 0.55f;
+        forceGain  = 0.5f;
+        xMin       = -2.0f;  xRange   = 4.0f;
+        yMin       = -2.5f;  yRange   = 5.0f;
+        dt_        = 0.05f;
+        cvScaleX   = 3.00f;  cvScaleY = 2.50f;
+    }
+    void init() override { s_[0] = 1.0f; s_[1] = 0.0f; s_[2] = 0.0f; }
+    void setParams(float chaos, float rate, float charV) override {
+        f_.gamma = chaos; dt_ = rate; f_.omega = charV;
+    }
+    inline void step(float h) {
+        Integ::step(f_, s_, h);
+        if (s_[2] > 6.28318f) s_[2] -= 6.28318f;  // keep phi in [0, 2π)
+    }
+    inline void force(float u) { f_.u = u; }
+    static constexpr int kDim = 3;
+    float* state() { return s_; }
+    float getX() const override { return s_[0]; }
+    float getY() const override { return s_[1]; }
+private:
+    DuffingField f_;
+    float s_[3] = {1.0f, 0.0f, 0.0f};
+};
+
+// ─── ChaosCoupledRossler ──────────────────────────────────────────────────────
+// Two Rössler systems with symmetric x-coupling.
+// dx1 = -y1 - z1 + k(x2-x1),   dy1 = x1 + a·y1,   dz1 = b + z1(x1-c)
+// dx2 = -y2 - z2 + k(x1-x2),   dy2 = x2 + a·y2,   dz2 = b + z2(x2-c)
+// CHAOS = c (bifurcation, 2–8, shared), CHAR = k (coupling, 0.0–0.5)
+// At low k: two detuned oscillators beating. At high k: synchronise.
+// Oscillators start at different ICs to ensure phase diversity.
+// Audio: x1→L, x2→R — true stereo output.
+class ChaosCoupledRossler final : public ChaosBlock<ChaosCoupledRossler> {
+public:
+    using Integ = CHAOS_INTEG_CPLROSSLER;
+    ChaosCoupledRossler() {
+        name       = "CPLROSSLER";   integName = Integ::name;
+        chaosLabel = "c"; charLabel  = "k";
+        chaosMin   = 2.0f;   chaosMax = 8.0f;
+        rateMin    = 0.002f; rateMax  = 0.10f;
+        charMin    = 0.0f;   charMax  = 0.5f;
+        modScale   = 1.0f;
+        gainL      = 0.10f;  gainR    = 0.10f;
+        forceGain  = 1.0f;
+        xMin       = -13.0f; xRange   = 26.0f;
+        yMin       = -11.0f; yRange   = 22.0f;
+        dt_        = 0.05f;
+        cvScaleX   = 0.45f;  cvScaleY = 0.45f;
+    }
+    void init() override {
+        s_[0]=0.1f; s_[1]=0.0f; s_[2]=0.0f;
+        s_[3]=0.5f; s_[4]=0.2f; s_[5]=0.0f;  // offset IC for phase diversity
+    }
+    void setParams(float chaos, float rate, float charV) override {
+        f_.c = chaos; dt_ = rate; f_.k = charV;
+    }
+    inline void step(float h) { Integ::step(f_, s_, h); }
+    inline void force(float u) { f_.u = u; }
+    static constexpr int kDim = 6;
+    float* state() { return s_; }
+    float getX() const override { return s_[0]; }
+    float getY() const override { return s_[3]; }
+private:
+    CoupledRosslerField f_;
+    float s_[6] = {0.1f, 0.0f, 0.0f, 0.5f, 0.2f, 0.0f};
+};
+
+// ─── ChaosPolyRossler ─────────────────────────────────────────────────────────
+// CHAOS_POLY_VOICES independent Rösslers integrated together as one
+// structure-of-arrays field (chaos_poly.h), so cost grows linearly with the
+// voice count. Voice rates spread evenly from 1× to (1 + 3·CHAR)× the RATE
+// step: CHAR = 0 is a unison of decorrelated copies, CHAR = 1 with four voices
+// the harmonic series 1:2:3:4.
+// CHAOS_POLY_COUPLING > 0 weakly couples the voices through their mean x.
+// CHAOS = c (shared, 2–8), CHAR = rate spread (0–1)
+// Audio: each voice's x, equal-power panned evenly across L..R.
+// CV: X and Y jacks each carry one voice's x; 'x' / 'y' on serial cycle them.
+#ifndef CHAOS_POLY_VOICES
+#define CHAOS_POLY_VOICES 4
+#endif
+#ifndef CHAOS_POLY_COUPLING
+#define CHAOS_POLY_COUPLING 0.0f
+#endif
+class ChaosPolyRossler final : public ChaosBlock<ChaosPolyRossler> {
+public:
+    using Integ = CHAOS_INTEG_POLY;
+    static constexpr int V = CHAOS_POLY_VOICES;
+    ChaosPolyRossler() {
+        name       = "POLY ROSS";   integName = Integ::name;
+        chaosLabel = "c"; charLabel  = "sp";
+        chaosMin   = 2.0f;   chaosMax = 8.0f;
+        rateMin    = 0.002f; rateMax  = 0.05f;   // fastest voice runs up to 4× this
+        charMin    = 0.0f;   charMax  = 1.0f;
+        modScale   = 1.0f;
+        gainL      = 0.12f;  gainR    = 0.12f;
+        forceGain  = 1.0f;
+        xMin       = -11.0f; xRange   = 22.0f;
+        yMin       = -11.0f; yRange   = 22.0f;
+        dt_        = 0.05f;
+        cvScaleX   = 0.50f;  cvScaleY = 0.50f;
+        f_.coupling = CHAOS_POLY_COUPLING;
+        // Voices sit at the centres of V equal slices of the stereo field;
+        // sqrt(2/V) keeps the summed level near one voice's
+        const float norm = sqrtf(2.0f / V);
+        for (int i = 0; i < V; i++) {
+            float th = (i + 0.5f) / V * 1.5707963f;
+            panL_[i] = norm * cosf(th); panR_[i] = norm * sinf(th);
+        }
+        cvVoice_[0] = 0; cvVoice_[1] = (V > 1) ? 1 : 0;
+        init();
+    }
+    void init() override {
+        // Spread initial conditions so unison voices separate immediately
+        for (int i = 0; i < V; i++) {
+            s_[i] = 0.1f + 0.4f * i; s_[V + i] = 0.2f * i; s_[2 * V + i] = 0.0f;
+        }
+    }
+    void setParams(float chaos, float rate, float charV) override {
+        dt_ = rate;
+        const float spread = (V > 1) ? 3.0f * charV / (V - 1) : 0.0f;
+        for (int i = 0; i < V; i++) { f_.f[i].c = chaos; f_.rate[i] = 1.0f + spread * i; }
+    }
+    inline void step(float h) {
+        Integ::step(f_, s_, h);
+        float sum = 0.0f;               // a non-finite voice poisons the sum
+        for (int i = 0; i < V; i++) sum += s_[i];
+        if (!isfinite(sum)) guardReset();
+    }
+    inline void force(float u) { for (int i = 0; i < V; i++) f_.f[i].u = u; }
+    static constexpr int kDim = PolyField<RosslerField, V>::N;
+    float* state() { return s_; }
+    float getX() const override { float a = 0.0f; for (int i = 0; i < V; i++) a += panL_[i] * s_[i]; return a; }
+    float getY() const override { float a = 0.0f; for (int i = 0; i < V; i++) a += panR_[i] * s_[i]; return a; }
+    float cvX() const override { return s_[cvVoice_[0]]; }
+    float cvY() const override { return s_[cvVoice_[1]]; }
+    // Assign the next voice to CV jack ch (0 = X, 1 = Y); returns it
+    uint8_t cycleCvVoice(uint8_t ch) { cvVoice_[ch] = (cvVoice_[ch] + 1) % V; return cvVoice_[ch]; }
+private:
+    PolyField<RosslerField, V> f_;
+    float s_[kDim];                 // x[V], y[V], z[V]
+    float panL_[V], panR_[V];
+    volatile uint8_t cvVoice_[2];
+};
+
+// ─── Auto-normalised flows ────────────────────────────────────────────────────
+// Thomas, Aizawa, Chen, Halvorsen and Sprott A span very different state
+// ranges; instead of hand-tuned window/gain metadata they set autoNorm and
+// the engine rescales X/Y to ±1 from the tracked range. gain* = pre-tanh
+// level of the normalised signal, cvScale* = volts at ±1.
+
+// ─── ChaosThomas ──────────────────────────────────────────────────────────────
+// dx = sin(y) - b*x, and cyclic. Slow, labyrinthine: takes large steps.
+// CHAOS = b (0.1–0.3: chaos → limit cycle), CHAR reserved
+class ChaosThomas final : public ChaosBlock<ChaosThomas> {
+public:
+    using Integ = CHAOS_INTEG_THOMAS;
+    ChaosThomas() {
+        name       = "THOMAS";   integName = Integ::name;   autoNorm = true;
+        chaosLabel = "b"; charLabel  = "-";
+        chaosMin   = 0.1f;   chaosMax = 0.3f;
+        rateMin    = 0.02f;  rateMax  = 0.5f;
+        charMin    = 0.0f;   charMax  = 1.0f;   // reserved
+        modScale   = 0.03f;
+        gainL      = 1.2f;   gainR    = 1.2f;
+        forceGain  = 0.5f;
+        dt_        = 0.1f;
+        cvScaleX   = 4.5f;   cvScaleY = 4.5f;
+    }
+    void init() override { s_[0] = 0.1f; s_[1] = 0.5f; s_[2] = 0.2f; }
+    void setParams(float chaos, float rate, float charV) override {
+        f_.b = fmaxf(chaos, 0.02f); dt_ = rate; (void)charV;
+    }
+    inline void step(float h) { Integ::step(f_, s_, h); }
+    inline void force(float u) { f_.u = u; }
+    static constexpr int kDim = 3;
+    float* state() { return s_; }
+    float getX() const override { return s_[0]; }
+    float getY() const override { return s_[1]; }
+private:
+    ThomasField f_;
+    float s_[3] = {0.1f, 0.5f, 0.2f};
+};
+
+// ─── ChaosAizawa ──────────────────────────────────────────────────────────────
+// Sphere-with-a-tube attractor; d sets the rotation rate around z.
+// CHAOS = a (0.6–1.0: ring → chaos), CHAR = d (2.5–4.5)
+class ChaosAizawa final : public ChaosBlock<ChaosAizawa> {
+public:
+    using Integ = CHAOS_INTEG_AIZAWA;
+    ChaosAizawa() {
+        name       = "AIZAWA";   integName = Integ::name;   autoNorm = true;
+        chaosLabel = "a"; charLabel  = "d";
+        chaosMin   = 0.6f;   chaosMax = 1.0f;
+        rateMin    = 0.002f; rateMax  = 0.05f;
+        charMin    = 2.5f;   charMax  = 4.5f;
+        modScale   = 0.1f;
+        gainL      = 1.2f;   gainR    = 1.2f;
+        forceGain  = 0.5f;
+        dt_        = 0.01f;
+        cvScaleX   = 4.5f;   cvScaleY = 4.5f;
+    }
+    void init() override { s_[0] = 0.1f; s_[1] = 0.0f; s_[2] = 0.0f; }
+    void setParams(float chaos, float rate, float charV) override {
+        f_.a = chaos; dt_ = rate; f_.d = charV;
+    }
+    inline void step(float h) {
+        Integ::step(f_, s_, h);
+        if (!isfinite(s_[0]) || fabsf(s_[2]) > 10.0f) guardReset();
+    }
+    inline void force(float u) { f_.u = u; }
+    static constexpr int kDim = 3;
+    float* state() { return s_; }
+    float getX() const override { return s_[0]; }
+    float getY() const override { return s_[1]; }
+private:
+    AizawaField f_;
+    float s_[3] = {0.1f, 0.0f, 0.0f};
+};
+
+// ─── ChaosChen ────────────────────────────────────────────────────────────────
+// dx = a(y - x),  dy = (c - a)x - xz + cy,  dz = xy - bz  (a = 35)
+// Lorenz-like double scroll, faster and stiffer. Audio/plot: x and z.
+// CHAOS = c (22–28.5), CHAR = b (2–4)
+class ChaosChen final : public ChaosBlock<ChaosChen> {
+public:
+    using Integ = CHAOS_INTEG_CHEN;
+    ChaosChen() {
+        name       = "CHEN";   integName = Integ::name;   autoNorm = true;
+        chaosLabel = "c"; charLabel  = "b";
+        chaosMin   = 22.0f;  chaosMax = 28.5f;
+        rateMin    = 0.0005f; rateMax = 0.004f;
+        charMin    = 2.0f;   charMax  = 4.0f;
+        modScale   = 1.0f;
+        gainL      = 1.2f;   gainR    = 1.2f;
+        forceGain  = 20.0f;
+        dt_        = 0.002f;
+        cvScaleX   = 4.5f;   cvScaleY = 4.5f;
+    }
+    void init() override { s_[0] = -1.0f; s_[1] = 0.0f; s_[2] = 0.5f; }
+    void setParams(float chaos, float rate, float charV) override {
+        f_.c = chaos; dt_ = rate; f_.b = charV;
+    }
+    inline void step(float h) {
+        Integ::step(f_, s_, h);
+        if (!isfinite(s_[0]) || fabsf(s_[0]) > 100.0f) guardReset();
+    }
+    inline void force(float u) { f_.u = u; }
+    static constexpr int kDim = 3;
+    float* state() { return s_; }
+    float getX() const override { return s_[0]; }
+    float getY() const override { return s_[2]; }
+private:
+    ChenField f_;
+    float s_[3] = {-1.0f, 0.0f, 0.5f};
+};
+
+// ─── ChaosHalvorsen ───────────────────────────────────────────────────────────
+// dx = -a*x - 4y - 4z - y^2, and cyclic. Three-lobed, strongly asymmetric.
+// CHAOS = a (1.25–1.6), CHAR reserved
+class ChaosHalvorsen final : public ChaosBlock<ChaosHalvorsen> {
+public:
+    using Integ = CHAOS_INTEG_HALVORSEN;
+    ChaosHalvorsen() {
+        name       = "HALVORSEN";   integName = Integ::name;   autoNorm = true;
+        chaosLabel = "a"; charLabel  = "-";
+        chaosMin   = 1.25f;  chaosMax = 1.6f;
+        rateMin    = 0.002f; rateMax  = 0.02f;
+        charMin    = 0.0f;   charMax  = 1.0f;   // reserved
+        modScale   = 0.05f;
+        gainL      = 1.2f;   gainR    = 1.2f;
+        forceGain  = 1.5f;
+        dt_        = 0.01f;
+        cvScaleX   = 4.5f;   cvScaleY = 4.5f;
+    }
+    void init() override { s_[0] = -1.0f; s_[1] = 0.0f; s_[2] = 0.5f; }
+    void setParams(float chaos, float rate, float charV) override {
+        f_.a = chaos; dt_ = rate; (void)charV;
+    }
+    inline void step(float h) {
+        Integ::step(f_, s_, h);
+        if (!isfinite(s_[0]) || fabsf(s_[0]) > 50.0f) guardReset();
+    }
+    inline void force(float u) { f_.u = u; }
+    static constexpr int kDim = 3;
+    float* state() { return s_; }
+    float getX() const override { return s_[0]; }
+    float getY() const override { return s_[1]; }
+private:
+    HalvorsenField f_;
+    float s_[3] = {-1.0f, 0.0f, 0.5f};
+};
+
+// ─── ChaosSprott ──────────────────────────────────────────────────────────────
+// Sprott A / Nosé–Hoover: dx = y,  dy = -x + yz,  dz = a - y^2. Conservative:
+// the orbit (torus or chaotic sea) depends on the initial condition, so RST
+// matters here. CHAOS = a (0.5–2), CHAR reserved
+class ChaosSprott final : public ChaosBlock<ChaosSprott> {
+public:
+    using Integ = CHAOS_INTEG_SPROTT;
+    ChaosSprott() {
+        name       = "SPROTT A";   integName = Integ::name;   autoNorm = true;
+        chaosLabel = "a"; charLabel  = "-";
+        chaosMin   = 0.5f;   chaosMax = 2.0f;
+        rateMin    = 0.01f;  rateMax  = 0.1f;
+        charMin    = 0.0f;   charMax  = 1.0f;   // reserved
+        modScale   = 0.3f;
+        gainL      = 1.2f;   gainR    = 1.2f;
+        forceGain  = 0.5f;
+        dt_        = 0.05f;
+        cvScaleX   = 4.5f;   cvScaleY = 4.5f;
+    }
+    void init() override { s_[0] = 0.0f; s_[1] = 5.0f; s_[2] = 0.0f; }
+    void setParams(float chaos, float rate, float charV) override {
+        f_.a = chaos; dt_ = rate; (void)charV;
+    }
+    inline void step(float h) {
+        Integ::step(f_, s_, h);
+        if (!isfinite(s_[0]) || fabsf(s_[1]) > 50.0f) guardReset();
+    }
+    inline void force(float u) { f_.u = u; }
+    static constexpr int kDim = 3;
+    float* state() { return s_; }
+    float getX() const override { return s_[0]; }
+    float getY() const override { return s_[1]; }
+private:
+    SprottAField f_;
+    float s_[3] = {0.0f, 5.0f, 0.0f};
+};
+
+// ─── ChaosLogistic ────────────────────────────────────────────────────────────
+// x' = r*x*(1 - x).  L = x, R = x one-pole smoothed per iterate (pseudo-stereo)
+// CHAOS = r (2.8–4: period doubling into chaos), CHAR = smoothing k (0.05–0.95)
+class ChaosLogistic final : public MapBlock<ChaosLogistic> {
+public:
+    ChaosLogistic() {
+        name       = "LOGISTIC";   integName = "map";   isMap = true;
+        chaosLabel = "r"; charLabel  = "k";
+        chaosMin   = 2.8f;   chaosMax = 4.0f;
+        rateMin    = 0.002f; rateMax  = 0.5f;   // iterates per sample
+        charMin    = 0.05f;  charMax  = 0.95f;
+        modScale   = 0.15f;
+        gainL      = 1.2f;   gainR    = 1.2f;
+        xMin       = -1.0f;  xRange   = 2.0f;
+        yMin       = -1.0f;  yRange   = 2.0f;
+        dt_        = 0.05f;
+        cvScaleX   = 4.0f;   cvScaleY = 4.0f;
+        init();
+    }
+    void init() override { m_.reset(); primeHistory(); }
+    void setParams(float chaos, float rate, float charV) override {
+        m_.r = fminf(chaos, 4.0f);   // r > 4 leaves [0, 1] and diverges
+        dt_ = rate; m_.k = charV;
+    }
+    inline void iterate() { m_.iterate(); }
+    inline float mapX() const { return m_.x(); }
+    inline float mapY() const { return m_.y(); }
+    static constexpr int kDim = 2;
+    float* state() { return m_.state(); }
+private:
+    LogisticMap m_;
+};
+
+// ─── ChaosHenon ───────────────────────────────────────────────────────────────
+// x' = 1 - a*x^2 + y,  y' = b*x.  L = x, R = y
+// CHAOS = a (1.0–1.42), CHAR = b (0.2–0.32)
+class ChaosHenon final : public MapBlock<ChaosHenon> {
+public:
+    ChaosHenon() {
+        name       = "HENON";   integName = "map";   isMap = true;
+        chaosLabel = "a"; charLabel  = "b";
+        chaosMin   = 1.0f;   chaosMax = 1.42f;
+        rateMin    = 0.002f; rateMax  = 0.5f;
+        charMin    = 0.2f;   charMax  = 0.32f;
+        modScale   = 0.1f;
+        gainL      = 1.2f;   gainR    = 1.2f;
+        xMin       = -1.0f;  xRange   = 2.0f;
+        yMin       = -1.0f;  yRange   = 2.0f;
+        dt_        = 0.05f;
+        cvScaleX   = 4.0f;   cvScaleY = 4.0f;
+        init();
+    }
+    void init() override { m_.reset(); primeHistory(); }
+    void setParams(float chaos, float rate, float charV) override {
+        m_.a = chaos; dt_ = rate; m_.b = charV;
+    }
+    inline void iterate() {
+        m_.iterate();
+        if (!isfinite(m_.xs) || fabsf(m_.xs) > 10.0f) m_.reset();   // escaped the basin
+    }
+    inline float mapX() const { return m_.x(); }
+    inline float mapY() const { return m_.y(); }
+    static constexpr int kDim = 2;
+    float* state() { return m_.state(); }
+private:
+    HenonMap m_;
+};
+
+// ─── ChaosIkeda ───────────────────────────────────────────────────────────────
+// t = k - 6/(1 + x^2 + y^2);  x' = 1 + u(x cos t - y sin t),  y' = u(x sin t + y cos t)
+// CHAOS = u (0.6–0.95: fixed point → spirals → chaos), CHAR = k (0.2–0.6)
+class ChaosIkeda final : public MapBlock<ChaosIkeda> {
+public:
+    ChaosIkeda() {
+        name       = "IKEDA";   integName = "map";   isMap = true;
+        chaosLabel = "u"; charLabel  = "k";
+        chaosMin   = 0.6f;   chaosMax = 0.95f;
+        rateMin    = 0.002f; rateMax  = 0.5f;
+        charMin    = 0.2f;   charMax  = 0.6f;
+        modScale   = 0.05f;
+        gainL      = 1.2f;   gainR    = 1.2f;
+        xMin       = -1.0f;  xRange   = 2.0f;
+        yMin       = -1.2f;  yRange   = 2.4f;
+        dt_        = 0.05f;
+        cvScaleX   = 4.0f;   cvScaleY = 3.5f;
+        init();
+    }
+    void init() override { m_.reset(); primeHistory(); }
+    void setParams(float chaos, float rate, float charV) override {
+        m_.u = fminf(chaos, 0.99f);   // u >= 1 is no longer contracting
+        dt_ = rate; m_.k = charV;
+    }
+    inline void iterate() { m_.iterate(); }
+    inline float mapX() const { return m_.x(); }
+    inline float mapY() const { return m_.y(); }
+    static constexpr int kDim = 2;
+    float* state() { return m_.state(); }
+private:
+    IkedaMap m_;
+};
+
+// ─── ChaosStandard ────────────────────────────────────────────────────────────
+// p' = p + K sin(theta),  theta' = theta + p' + w  (torus).  L = theta, R = p
+// CHAOS = K (0.2–8: KAM islands → global chaos), CHAR = rotation w (0–1)
+class ChaosStandard final : public MapBlock<ChaosStandard> {
+public:
+    ChaosStandard() {
+        name       = "STANDARD";   integName = "map";   isMap = true;
+        chaosLabel = "K"; charLabel  = "w";
+        chaosMin   = 0.2f;   chaosMax = 8.0f;
+        rateMin    = 0.002f; rateMax  = 0.5f;
+        charMin    = 0.0f;   charMax  = 1.0f;
+        modScale   = 1.0f;
+        gainL      = 1.0f;   gainR    = 1.0f;
+        xMin       = -1.0f;  xRange   = 2.0f;
+        yMin       = -1.0f;  yRange   = 2.0f;
+        dt_        = 0.05f;
+        cvScaleX   = 4.0f;   cvScaleY = 4.0f;
+        init();
+    }
+    void init() override { m_.reset(); primeHistory(); }
+    void setParams(float chaos, float rate, float charV) override {
+        m_.K = chaos; dt_ = rate; m_.w = charV;
+    }
+    inline void iterate() { m_.iterate(); }
+    inline float mapX() const { return m_.x(); }
+    inline float mapY() const { return m_.y(); }
+    static constexpr int kDim = 2;
+    float* state() { return m_.state(); }
+private:
+    StandardMap m_;
+};
+
+// ─── ChaosMandelbrot ──────────────────────────────────────────────────────────
+// Orbit of z' = z^2 + c from 0, restarting on escape or after 256 iterates.
+// L = Re z, R = Im z.  CHAOS = Re c (-2–0.35), CHAR = Im c (-1–1)
+class ChaosMandelbrot final : public MapBlock<ChaosMandelbrot> {
+public:
+    ChaosMandelbrot() {
+        name       = "MANDELBROT";   integName = "map";   isMap = true;
+        chaosLabel = "re"; charLabel  = "im";
+        chaosMin   = -2.0f;  chaosMax = 0.35f;
+        rateMin    = 0.002f; rateMax  = 0.5f;
+        charMin    = -1.0f;  charMax  = 1.0f;
+        modScale   = 0.25f;
+        gainL      = 1.2f;   gainR    = 1.2f;
+        xMin       = -1.0f;  xRange   = 2.0f;
+        yMin       = -1.0f;  yRange   = 2.0f;
+        dt_        = 0.05f;
+        cvScaleX   = 4.0f;   cvScaleY = 4.0f;
+        init();
+    }
+    void init() override { m_.reset(); primeHistory(); }
+    void setParams(float chaos, float rate, float charV) override {
+        m_.cr = chaos; dt_ = rate; m_.ci = charV;
+    }
+    inline void iterate() { m_.iterate(); }
+    inline float mapX() const { return m_.x(); }
+    inline float mapY() const { return m_.y(); }
+    static constexpr int kDim = 2;
+    float* state() { return m_.state(); }
+private:
+    MandelbrotOrbit m_;
+};
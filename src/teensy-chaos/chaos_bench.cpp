@@ -0,0 +1,149 @@
+#include "chaos_bench.h"
+#include "chaos_systems.h"
+#include "chaos_integrators.h"
+#include "chaos_poly.h"
+#include "chaos_maps.h"
+
+static const int kBlock      = 128;
+static const int kReps       = 16;
+static const int kDriftSteps = 256;
+static const int kRefSub     = 8;
+static const int kLongSteps  = 44100;
+static const float kBound    = 1.0e3f;
+
+// Keep the compiler from sinking the integration past the cycle-counter read
+static inline void benchBarrier(const float* s) { __asm__ volatile("" : : "r"(s) : "memory"); }
+
+// Same phase wrap the algorithm applies after each step (Duffing's drive
+// phase grows without bound otherwise)
+template <class F> static inline void benchWrap(float*) {}
+template <> inline void benchWrap<DuffingField>(float* s) { if (s[2] > 6.28318f) s[2] -= 6.28318f; }
+
+template <class I, class F>
+static void benchOne(Print& out, const char* sys, const F& f, const float* s0, float dt) {
+    float s[F::N], r[F::N];
+
+    uint32_t best = 0xFFFFFFFFu;
+    for (int rep = 0; rep < kReps; rep++) {
+        for (int k = 0; k < F::N; k++) s[k] = s0[k];
+        benchBarrier(s);
+        uint32_t t0 = ARM_DWT_CYCCNT;
+        for (int i = 0; i < kBlock; i++) I::step(f, s, dt);
+        benchBarrier(s);
+        uint32_t cyc = ARM_DWT_CYCCNT - t0;
+        if (cyc < best) best = cyc;
+    }
+
+    for (int k = 0; k < F::N; k++) { s[k] = s0[k]; r[k] = s0[k]; }
+    float errMax = 0.0f, refMax = 1.0e-6f;
+    const float h = dt / kRefSub;
+    for (int n = 0; n < kDriftSteps; n++) {
+        I::step(f, s, dt); benchWrap<F>(s);
+        for (int j = 0; j < kRefSub; j++) RK4::step(f, r, h);
+        benchWrap<F>(r);
+        for (int k = 0; k < F::N; k++) {
+            float e = fabsf(s[k] - r[k]), m = fabsf(r[k]);
+            if (!isfinite(e)) errMax = INFINITY; else if (e > errMax) errMax = e;
+            if (m > refMax) refMax = m;
+        }
+    }
+
+    bool ok = true;
+    for (int k = 0; k < F::N; k++) s[k] = s0[k];
+    for (int n = 0; n < kLongSteps && ok; n++) {
+        I::step(f, s, dt); benchWrap<F>(s);
+        if ((n & 63) == 0) for (int k = 0; k < F::N; k++) if (!isfinite(s[k]) || fabsf(s[k]) > kBound) ok = false;
+    }
+
+    out.printf("[bench] %-11s %-6s %6.1f   %8.2e   %s\n", sys, I::name,
+               (float)best / kBlock, errMax / refMax, ok ? "ok" : "DIVERGED");
+}
+
+template <class F>
+static void benchSystem(Print& out, const char* sys, const F& f, const float* s0, float dt) {
+    benchOne<Euler>(out, sys, f, s0, dt);
+    benchOne<Heun>(out, sys, f, s0, dt);
+    benchOne<RK4>(out, sys, f, s0, dt);
+    benchOne<Symplectic>(out, sys, f, s0, dt);
+}
+
+// V Rösslers as one SoA field (chaos_poly.h), rates 1:2:..:V, RK4. Prints
+// cycles per sample and the cost relative to V single voices (ref = one voice)
+template <int V>
+static uint32_t benchPoly(Print& out, uint32_t ref) {
+    constexpr int N = PolyField<RosslerField, V>::N;
+    PolyField<RosslerField, V> f;
+    float s0[N], s[N];
+    for (int i = 0; i < V; i++) {
+        f.rate[i] = 1.0f + i;
+        s0[i] = 0.1f + 0.4f * i; s0[V + i] = 0.2f * i; s0[2 * V + i] = 0.0f;
+    }
+    uint32_t best = 0xFFFFFFFFu;
+    for (int rep = 0; rep < kReps; rep++) {
+        for (int k = 0; k < N; k++) s[k] = s0[k];
+        benchBarrier(s);
+        uint32_t t0 = ARM_DWT_CYCCNT;
+        for (int i = 0; i < kBlock; i++) RK4::step(f, s, 0.05f);
+        benchBarrier(s);
+        uint32_t cyc = ARM_DWT_CYCCNT - t0;
+        if (cyc < best) best = cyc;
+    }
+    if (!ref) ref = best;
+    out.printf("[bench] POLY x%d      RK4    %6.1f   %.2f of %d voices\n", V,
+               (float)best / kBlock, (float)best / (ref * V), V);
+    return best;
+}
+
+// One map iterate at default parameters (interpolation adds ~10 cycles per
+// output sample on top, whatever the map)
+template <class M>
+static void benchMap(Print& out, const char* sys) {
+    M m;
+    uint32_t best = 0xFFFFFFFFu;
+    for (int rep = 0; rep < kReps; rep++) {
+        m.reset();
+        benchBarrier(reinterpret_cast<const float*>(&m));
+        uint32_t t0 = ARM_DWT_CYCCNT;
+        for (int i = 0; i < kBlock; i++) m.iterate();
+        benchBarrier(reinterpret_cast<const float*>(&m));
+        uint32_t cyc = ARM_DWT_CYCCNT - t0;
+        if (cyc < best) best = cyc;
+    }
+    out.printf("[bench] %-11s map    %6.1f   (per iterate)\n", sys, (float)best / kBlock);
+}
+
+// Default parameters, each system at the fast end of its RATE range (where
+// the integrator choice matters most), same initial conditions as init()
+void chaosBenchRun(Print& out) {
+    out.printf("[bench] system      integ  cyc/smp  err@%d  1s\n", kDriftSteps);
+    { RosslerField f;                const float s0[] = {0.1f, 0.0f, 0.0f};
+      benchSystem(out, "ROSSLER", f, s0, 0.1f); }
+    { VanDerPolField f; f.mu = 4.0f; const float s0[] = {2.0f, 0.0f};
+      benchSystem(out, "VAN DER POL", f, s0, 1.0f / (4.0f + 2.0f)); }   // the algorithm's dt cap
+    { LorenzField f;                 const float s0[] = {0.1f, 0.0f, 0.0f};
+      benchSystem(out, "LORENZ", f, s0, 0.003f); }
+    { ChuaField f;                   const float s0[] = {0.5f, 0.0f, 0.0f};
+      benchSystem(out, "CHUA", f, s0, 0.008f); }
+    { DuffingField f;                const float s0[] = {1.0f, 0.0f, 0.0f};
+      benchSystem(out, "DUFFING", f, s0, 0.1f); }
+    { CoupledRosslerField f;         const float s0[] = {0.1f, 0.0f, 0.0f, 0.5f, 0.2f, 0.0f};
+      benchSystem(out, "CPLROSSLER", f, s0, 0.1f); }
+    { ThomasField f;                 const float s0[] = {0.1f, 0.5f, 0.2f};
+      benchSystem(out, "THOMAS", f, s0, 0.5f); }
+    { AizawaField f;                 const float s0[] = {0.1f, 0.0f, 0.0f};
+      benchSystem(out, "AIZAWA", f, s0, 0.05f); }
+    { ChenField f;                   const float s0[] = {-1.0f, 0.0f, 0.5f};
+      benchSystem(out, "CHEN", f, s0, 0.004f); }
+    { HalvorsenField f;              const float s0[] = {-1.0f, 0.0f, 0.5f};
+      benchSystem(out, "HALVORSEN", f, s0, 0.02f); }
+    { SprottAField f;                const float s0[] = {0.0f, 5.0f, 0.0f};
+      benchSystem(out, "SPROTT A", f, s0, 0.1f); }
+    uint32_t one = benchPoly<1>(out, 0);
+    benchPoly<2>(out, one); benchPoly<4>(out, one); benchPoly<8>(out, one);
+    benchMap<LogisticMap>(out, "LOGISTIC");
+    benchMap<HenonMap>(out, "HENON");
+    benchMap<IkedaMap>(out, "IKEDA");
+    benchMap<StandardMap>(out, "STANDARD");
+    benchMap<MandelbrotOrbit>(out, "MANDELBROT");
+    out.printf("[bench] budget %.0f cyc/smp at 44.1 kHz, %lu MHz\n", (float)F_CPU_ACTUAL / 44100.0f, (unsigned long)(F_CPU_ACTUAL / 1000000));
+}
@@ -0,0 +1,15 @@
+#pragma once
+#include <Arduino.h>
+
+// Integrator benchmark: every continuous system (chaos_systems.h) through
+// every integrator (chaos_integrators.h). Per combination it prints:
+//   cyc/smp   best-of-16 DWT cycles per step over a 128-step block
+//   err       max trajectory error over 256 steps against RK4 at dt/8,
+//             relative to the reference's peak magnitude
+//   1s        whether one second of audio-rate steps stays finite and bounded
+// then the polyphonic Rössler (chaos_poly.h) at 1/2/4/8 voices with its cost
+// as a fraction of running that many single voices, and the cycles per
+// iterate of each discrete map (chaos_maps.h).
+// Runs in the caller's context (~0.3 s); audio keeps running, and the
+// best-of timing rejects its interrupts.
+void chaosBenchRun(Print& out);
@@ -0,0 +1,123 @@
+#pragma once
+#include <stdint.h>
+#include <math.h>
+
+// Block-wise output stage for the chaos engine: soft clip, DC blocker and
+// int16 conversion over contiguous float buffers. No Arduino dependencies.
+
+// tanh via the [5/4] Padé approximant, clamped where it reaches 1
+// (|x| = 3.64). Max error vs tanhf 1.4e-3; branch-free so the block loop
+// stays straight-line.
+static constexpr float kSoftClipKnee = 3.64f;
+
+static inline float fastTanh(float x) {
+    x = fminf(fmaxf(x, -kSoftClipKnee), kSoftClipKnee);
+    float x2 = x * x;
+    return x * (945.0f + x2 * (105.0f + x2)) / (945.0f + x2 * (420.0f + 15.0f * x2));
+}
+
+// buf[i] = tanh((buf[i] - offset) * gain), in place
+static inline void softClipBlock(float* buf, int n, float gain, float offset = 0.0f) {
+    for (int i = 0; i < n; i++) buf[i] = fastTanh((buf[i] - offset) * gain);
+}
+
+// One-pole DC blocker (leaky mean subtracted from the signal), ~5 Hz at 44.1 kHz
+struct DcBlocker {
+    static constexpr float kCoeff = 0.0007f;
+    float dc = 0.0f;
+    void reset() { dc = 0.0f; }
+    void process(float* buf, int n) {
+        float d = dc;
+        for (int i = 0; i < n; i++) { float v = buf[i] - d; d += v * kCoeff; buf[i] = v; }
+        dc = d;
+    }
+};
+
+// Running output range for auto-normalised algorithms. track() takes a
+// block's min/max, follows expansions at once and contractions slowly
+// (time constant ~2 s of blocks), and derives offset/scale mapping the range
+// to ±1: one division per block, so per sample the caller only applies
+// (x - offset) * scale, folded into its existing gain.
+struct AutoRange {
+    static constexpr float kRelease = 0.0015f;  // per 128-sample block
+    static constexpr float kMinSpan = 1.0e-3f;  // don't blow up a fixed point
+    float lo = -1.0f, hi = 1.0f;
+    float offset = 0.0f, scale = 1.0f;
+    bool  primed = false;
+
+    void track(const float* buf, int n) {
+        float bl = buf[0], bh = buf[0];
+        for (int i = 1; i < n; i++) { bl = fminf(bl, buf[i]); bh = fmaxf(bh, buf[i]); }
+        if (!isfinite(bl) || !isfinite(bh)) return;
+        if (!primed) { lo = bl; hi = bh; primed = true; }
+        else {
+            lo = (bl < lo) ? bl : lo + (bl - lo) * kRelease;
+            hi = (bh > hi) ? bh : hi + (bh - hi) * kRelease;
+        }
+        offset = 0.5f * (hi + lo);
+        scale  = 2.0f / fmaxf(hi - lo, kMinSpan);
+    }
+};
+
+// Scale and saturate to int16 (the DC blocker can push a clipped signal past 1)
+static inline void floatToInt16Block(const float* in, int16_t* out, int n, float scale) {
+    for (int i = 0; i < n; i++) out[i] = (int16_t)fminf(fmaxf(in[i] * scale, -32767.0f), 32767.0f);
+}
+
+// int16 → float, scaled (input side: line-in forcing)
+static inline void int16ToFloatBlock(const int16_t* in, float* out, int n, float scale) {
+    for (int i = 0; i < n; i++) out[i] = in[i] * scale;
+}
+
+// 2:1 half-band decimator, 31 taps (Kaiser β=8): passband to 0.16·fs_in
+// ±1e-4, stopband from 0.34·fs_in at −80 dB. Even taps other than the centre
+// are zero, so each output costs 8 symmetric MACs plus the centre tap.
+// The history is a doubled ring so the 31-sample window is always contiguous.
+struct HalfbandDecimator {
+    static constexpr int TAPS = 31, CENTER = 15, SIDE = 8;
+    float hist[2 * TAPS] = {};
+    int pos = 0;
+
+    void reset(float v) { for (int i = 0; i < 2 * TAPS; i++) hist[i] = v; pos = 0; }
+
+    inline void push(float v) {
+        hist[pos] = v; hist[pos + TAPS] = v;
+        if (++pos == TAPS) pos = 0;
+    }
+
+    // Filter output centred on the newest window (oldest sample first)
+    inline float output() const {
+        static constexpr float kSide[SIDE] = {
+            0.313035144f, -0.091221782f, 0.041535327f, -0.019227000f,
+            0.008020058f, -0.002734351f, 0.000642233f, -0.000049628f
+        };
+        const float* x = hist + pos;
+        float acc = 0.5f * x[CENTER];
+        for (int j = 0; j < SIDE; j++) acc += kSide[j] * (x[CENTER - 1 - 2 * j] + x[CENTER + 1 + 2 * j]);
+        return acc;
+    }
+
+    // in[2*nOut] → out[nOut]; out may alias in
+    void process(const float* in, float* out, int nOut) {
+        for (int m = 0; m < nOut; m++) {
+            push(in[2 * m]); push(in[2 * m + 1]);
+            out[m] = output();
+        }
+    }
+};
+
+// Cascade of half-band stages for 1x / 2x / 4x / 8x oversampling. run()
+// decimates buf[len] in place down to len/os samples.
+struct OversampleDecimator {
+    static constexpr int MAX_STAGES = 3;           // 8x
+    HalfbandDecimator stage[MAX_STAGES];
+
+    void reset(float v) { for (int s = 0; s < MAX_STAGES; s++) stage[s].reset(v); }
+
+    void run(float* buf, int len, uint8_t os) {
+        for (int s = 0; os > 1 && s < MAX_STAGES; s++, os >>= 1) {
+            len >>= 1;
+            stage[s].process(buf, buf, len);
+        }
+    }
+};
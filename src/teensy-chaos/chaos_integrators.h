@@ -0,0 +1,71 @@
+#pragma once
+
+// Fixed-step integrators for the continuous chaos systems.
+//
+// Each integrator is a stateless struct with one static step() that advances
+// a state vector s[F::N] by dt through a vector field F (see
+// chaos_systems.h): `void F::operator()(const float* s, float* ds) const`.
+// Everything is inline and N is a compile-time constant, so an
+// (integrator, field) pair compiles to straight-line code with no calls.
+//
+// Cost vs stability, per step:
+//   Euler       1 eval  1st order  cheapest, spirals outward on oscillators
+//   Heun        2 evals 2nd order  explicit trapezoid
+//   RK4         4 evals 4th order  reference; what every algorithm used before
+//   Symplectic  ~1 eval 1st order  semi-implicit (component-sequential) Euler:
+//                                  each component sees the ones already
+//                                  advanced this step. For x'=y, y'=g(x,y)
+//                                  systems it is symplectic Euler, which keeps
+//                                  oscillator energy bounded where Euler drifts
+
+struct Euler {
+    static constexpr const char* name = "Euler";
+    template <class F>
+    static inline void step(const F& f, float* s, float dt) {
+        float d[F::N];
+        f(s, d);
+        for (int i = 0; i < F::N; i++) s[i] += dt * d[i];
+    }
+};
+
+struct Heun {
+    static constexpr const char* name = "Heun";
+    template <class F>
+    static inline void step(const F& f, float* s, float dt) {
+        float k1[F::N], k2[F::N], t[F::N];
+        f(s, k1);
+        for (int i = 0; i < F::N; i++) t[i] = s[i] + dt * k1[i];
+        f(t, k2);
+        const float h = 0.5f * dt;
+        for (int i = 0; i < F::N; i++) s[i] += h * (k1[i] + k2[i]);
+    }
+};
+
+struct RK4 {
+    static constexpr const char* name = "RK4";
+    template <class F>
+    static inline void step(const F& f, float* s, float dt) {
+        float k1[F::N], k2[F::N], k3[F::N], k4[F::N], t[F::N];
+        const float h = 0.5f * dt;
+        f(s, k1);
+        for (int i = 0; i < F::N; i++) t[i] = s[i] + h * k1[i];
+        f(t, k2);
+        for (int i = 0; i < F::N; i++) t[i] = s[i] + h * k2[i];
+        f(t, k3);
+        for (int i = 0; i < F::N; i++) t[i] = s[i] + dt * k3[i];
+        f(t, k4);
+        const float w = dt * (1.0f / 6.0f);
+        for (int i = 0; i < F::N; i++) s[i] += w * (k1[i] + 2.0f * (k2[i] + k3[i]) + k4[i]);
+    }
+};
+
+// Only d[i] of each evaluation is used, so once inlined and unrolled the
+// compiler drops the other components: total cost is about one field eval.
+struct Symplectic {
+    static constexpr const char* name = "Sympl";
+    template <class F>
+    static inline void step(const F& f, float* s, float dt) {
+        float d[F::N];
+        for (int i = 0; i < F::N; i++) { f(s, d); s[i] += dt * d[i]; }
+    }
+};
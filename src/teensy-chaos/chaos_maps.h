@@ -0,0 +1,103 @@
+#pragma once
+#include <math.h>
+#include <stddef.h>
+
+// Iterated maps for the discrete algorithm family. Each map holds its
+// parameters and state; iterate() advances one step, x()/y() read the current
+// iterate scaled to roughly ±1, reset() restores the initial condition.
+// state() exposes the two state variables as a float[2] (tools perturb it).
+// No Arduino dependencies.
+
+// Logistic: x' = r*x*(1 - x). Y is x one-pole smoothed per iterate
+// (pseudo-stereo): y' = y + k*(x - y).
+struct LogisticMap {
+    float r = 3.7f, k = 0.3f;
+    float xs = 0.4f, ys = 0.4f;
+    void reset() { xs = 0.4f; ys = 0.4f; }
+    inline void iterate() {
+        xs = r * xs * (1.0f - xs);
+        ys += k * (xs - ys);
+    }
+    float* state() { return &xs; }
+    inline float x() const { return 2.0f * xs - 1.0f; }
+    inline float y() const { return 2.0f * ys - 1.0f; }
+};
+
+// Hénon: x' = 1 - a*x^2 + y,  y' = b*x
+struct HenonMap {
+    float a = 1.4f, b = 0.3f;
+    float xs = 0.1f, ys = 0.0f;
+    void reset() { xs = 0.1f; ys = 0.0f; }
+    inline void iterate() {
+        float xn = 1.0f - a * xs * xs + ys;
+        ys = b * xs;
+        xs = xn;
+    }
+    float* state() { return &xs; }
+    inline float x() const { return xs * (1.0f / 1.3f); }
+    inline float y() const { return ys * (1.0f / 0.4f); }
+};
+
+// Ikeda: t = k - 6/(1 + x^2 + y^2)
+//        x' = 1 + u*(x*cos t - y*sin t),  y' = u*(x*sin t + y*cos t)
+struct IkedaMap {
+    float u = 0.9f, k = 0.4f;
+    float xs = 0.1f, ys = 0.1f;
+    void reset() { xs = 0.1f; ys = 0.1f; }
+    inline void iterate() {
+        float t = k - 6.0f / (1.0f + xs * xs + ys * ys);
+        float c = cosf(t), s = sinf(t);
+        float xn = 1.0f + u * (xs * c - ys * s);
+        ys = u * (xs * s + ys * c);
+        xs = xn;
+    }
+    float* state() { return &xs; }
+    inline float x() const { return (xs - 0.6f) * (1.0f / 1.2f); }
+    inline float y() const { return (ys + 0.7f) * (1.0f / 1.3f); }
+};
+
+// Chirikov standard map on the torus, with a rotation term w:
+// p' = p + K*sin(theta),  theta' = theta + p' + w   (both wrapped to [-pi, pi))
+struct StandardMap {
+    float K = 1.2f, w = 0.0f;
+    float th = 0.5f, p = 0.3f;
+    void reset() { th = 0.5f; p = 0.3f; }
+    static inline float wrap(float v) {
+        const float kPi = 3.14159265f, k2Pi = 6.28318531f;
+        return v - k2Pi * floorf((v + kPi) * (1.0f / k2Pi));
+    }
+    inline void iterate() {
+        p  = wrap(p + K * sinf(th));
+        th = wrap(th + p + w);
+    }
+    float* state() { return &th; }
+    inline float x() const { return th * (1.0f / 3.14159265f); }
+    inline float y() const { return p * (1.0f / 3.14159265f); }
+};
+
+// Mandelbrot orbit: z' = z^2 + c from z = 0. The orbit restarts when it
+// escapes (|z| > 2) or after maxIter iterates, so bounded orbits loop as a
+// periodic burst and escaping ones retrigger.
+struct MandelbrotOrbit {
+    static constexpr int maxIter = 256;
+    float cr = -0.75f, ci = 0.1f;
+    float zr = 0.0f, zi = 0.0f;
+    int   n = 0;
+    void reset() { zr = 0.0f; zi = 0.0f; n = 0; }
+    inline void iterate() {
+        float r2 = zr * zr, i2 = zi * zi;
+        if (r2 + i2 > 4.0f || ++n >= maxIter) { reset(); return; }
+        zi = 2.0f * zr * zi + ci;
+        zr = r2 - i2 + cr;
+    }
+    float* state() { return &zr; }
+    inline float x() const { return fminf(fmaxf(zr * 0.5f, -1.0f), 1.0f); }
+    inline float y() const { return fminf(fmaxf(zi * 0.5f, -1.0f), 1.0f); }
+};
+
+// state() relies on the two state floats being adjacent
+static_assert(offsetof(LogisticMap, ys) == offsetof(LogisticMap, xs) + sizeof(float), "state layout");
+static_assert(offsetof(HenonMap, ys) == offsetof(HenonMap, xs) + sizeof(float), "state layout");
+static_assert(offsetof(IkedaMap, ys) == offsetof(IkedaMap, xs) + sizeof(float), "state layout");
+static_assert(offsetof(StandardMap, p) == offsetof(StandardMap, th) + sizeof(float), "state layout");
+static_assert(offsetof(MandelbrotOrbit, zi) == offsetof(MandelbrotOrbit, zr) + sizeof(float), "state layout");
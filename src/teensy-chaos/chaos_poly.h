@@ -0,0 +1,42 @@
+#pragma once
+#include "chaos_systems.h"
+
+// V instances of one vector field as a single structure-of-arrays field.
+//
+// State layout is component-major: s[k*V + i] is component k of voice i, so
+// every integrator loop in chaos_integrators.h ("t[j] = s[j] + h*k[j]" over
+// N = F::N*V) walks contiguous memory across independent voices. The M7 has
+// no float SIMD, but the voices carry no dependencies on each other, so the
+// FPU pipeline interleaves them instead of stalling on one voice's chain.
+// Cost is one field evaluation per voice plus the (tiny) coupling term, i.e.
+// linear in V.
+//
+// Each voice has its own parameters (f[i]) and its own time scale (rate[i]:
+// the voice runs rate[i] times faster than the shared step), so one integrator
+// step moves every voice at its own speed. coupling > 0 adds weak mean-field
+// coupling on component 0: dx_i += rate_i * coupling * (mean(x) - x_i).
+template <class F, int V>
+struct PolyField {
+    static constexpr int N = F::N * V;
+    static constexpr int VOICES = V;
+    F     f[V];
+    float rate[V];
+    float coupling = 0.0f;
+
+    PolyField() { for (int i = 0; i < V; i++) rate[i] = 1.0f; }
+
+    inline void operator()(const float* s, float* d) const {
+        for (int i = 0; i < V; i++) {
+            float si[F::N], di[F::N];
+            for (int k = 0; k < F::N; k++) si[k] = s[k * V + i];
+            f[i](si, di);
+            for (int k = 0; k < F::N; k++) d[k * V + i] = rate[i] * di[k];
+        }
+        if (coupling != 0.0f) {
+            float mean = 0.0f;
+            for (int i = 0; i < V; i++) mean += s[i];
+            mean *= 1.0f / V;
+            for (int i = 0; i < V; i++) d[i] += rate[i] * coupling * (mean - s[i]);
+        }
+    }
+};
@@ -0,0 +1,165 @@
+#pragma once
+#include <math.h>
+
+// Vector fields of the continuous chaos systems, separated from how they are
+// integrated (chaos_integrators.h). A field holds its parameters and maps a
+// state s[N] to its time derivative ds[N]. No Arduino dependencies.
+//
+// u is an external forcing input (line-in audio, already scaled into
+// derivative units), added to one derivative per field; u = 0 leaves the
+// autonomous system.
+
+// Rössler: dx = -y - z,  dy = x + a*y,  dz = b + z*(x - c)
+struct RosslerField {
+    static constexpr int N = 3;
+    float a = 0.2f, b = 0.2f, c = 5.7f;
+    float u = 0.0f;                     // forcing on dx
+    inline void operator()(const float* s, float* d) const {
+        d[0] = -s[1] - s[2] + u;
+        d[1] = s[0] + a * s[1];
+        d[2] = b + s[2] * (s[0] - c);
+    }
+};
+
+// Van der Pol: dx = y,  dy = mu*(1 - x^2)*y - x
+struct VanDerPolField {
+    static constexpr int N = 2;
+    float mu = 1.0f;
+    float u = 0.0f;                     // forcing on dy (forced Van der Pol)
+    inline void operator()(const float* s, float* d) const {
+        d[0] = s[1];
+        d[1] = mu * (1.0f - s[0] * s[0]) * s[1] - s[0] + u;
+    }
+};
+
+// Lorenz: dx = sigma*(y - x),  dy = x*(rho - z) - y,  dz = x*y - beta*z
+struct LorenzField {
+    static constexpr int N = 3;
+    float sigma = 10.0f, rho = 28.0f, beta = 2.667f;
+    float u = 0.0f;                     // forcing on dx
+    inline void operator()(const float* s, float* d) const {
+        d[0] = sigma * (s[1] - s[0]) + u;
+        d[1] = s[0] * (rho - s[2]) - s[1];
+        d[2] = s[0] * s[1] - beta * s[2];
+    }
+};
+
+// Chua: dx = alpha*(y - x - f(x)),  dy = x - y + z,  dz = -beta*y
+// f(x): piecewise-linear diode. Standard double-scroll slopes, both negative:
+// with m0 = -8/7, m1 = -5/7 the equilibria sit at x = 0 and x = ±1.5.
+struct ChuaField {
+    static constexpr int N = 3;
+    static constexpr float m0 = -8.0f / 7.0f;   // inner slope
+    static constexpr float m1 = -5.0f / 7.0f;   // outer slope
+    float alpha = 9.0f, beta = 14.286f;
+    float u = 0.0f;                     // current injected into the C1 node
+    static inline float diode(float x) {
+        if (x >  1.0f) return m1 * x + (m0 - m1);
+        if (x < -1.0f) return m1 * x - (m0 - m1);
+        return m0 * x;
+    }
+    inline void operator()(const float* s, float* d) const {
+        d[0] = alpha * (s[1] - s[0] - diode(s[0]) + u);
+        d[1] = s[0] - s[1] + s[2];
+        d[2] = -beta * s[1];
+    }
+};
+
+// Duffing, autonomous form with the drive phase as a state variable:
+// dx = y,  dy = -delta*y - alpha*x - beta*x^3 + gamma*cos(phi),  dphi = omega
+// alpha = -1, beta = 1 (double well), delta = 0.3 (damping).
+struct DuffingField {
+    static constexpr int N = 3;
+    static constexpr float alpha = -1.0f, beta = 1.0f, delta = 0.3f;
+    float gamma = 0.4f, omega = 1.2f;
+    float u = 0.0f;                     // added to the drive term
+    inline void operator()(const float* s, float* d) const {
+        float x = s[0];
+        d[0] = s[1];
+        d[1] = -delta * s[1] - alpha * x - beta * x * x * x + gamma * cosf(s[2]) + u;
+        d[2] = omega;
+    }
+};
+
+// Two Rössler systems coupled through x (state x1,y1,z1,x2,y2,z2):
+// dx1 = -y1 - z1 + k(x2 - x1), dy1 = x1 + a*y1, dz1 = b + z1*(x1 - c), same for 2
+struct CoupledRosslerField {
+    static constexpr int N = 6;
+    static constexpr float a = 0.2f, b = 0.2f;
+    float c = 5.7f, k = 0.05f;
+    float u = 0.0f;                     // common forcing on dx1 and dx2
+    inline void operator()(const float* s, float* d) const {
+        d[0] = -s[1] - s[2] + k * (s[3] - s[0]) + u;
+        d[1] = s[0] + a * s[1];
+        d[2] = b + s[2] * (s[0] - c);
+        d[3] = -s[4] - s[5] + k * (s[0] - s[3]) + u;
+        d[4] = s[3] + a * s[4];
+        d[5] = b + s[5] * (s[3] - c);
+    }
+};
+
+// Thomas (cyclically symmetric): dx = sin(y) - b*x, dy = sin(z) - b*y, dz = sin(x) - b*z
+struct ThomasField {
+    static constexpr int N = 3;
+    float b = 0.208186f;
+    float u = 0.0f;                     // forcing on dx
+    inline void operator()(const float* s, float* d) const {
+        d[0] = sinf(s[1]) - b * s[0] + u;
+        d[1] = sinf(s[2]) - b * s[1];
+        d[2] = sinf(s[0]) - b * s[2];
+    }
+};
+
+// Aizawa: dx = (z - b)x - d*y,  dy = d*x + (z - b)y,
+//         dz = c + a*z - z^3/3 - (x^2 + y^2)(1 + e*z) + f*z*x^3
+// b = 0.7, c = 0.6, e = 0.25, f = 0.1 fixed.
+struct AizawaField {
+    static constexpr int N = 3;
+    static constexpr float b = 0.7f, c = 0.6f, e = 0.25f, f = 0.1f;
+    float a = 0.95f, d = 3.5f;
+    float u = 0.0f;                     // forcing on dx
+    inline void operator()(const float* s, float* ds) const {
+        float x = s[0], y = s[1], z = s[2], zb = z - b;
+        ds[0] = zb * x - d * y + u;
+        ds[1] = d * x + zb * y;
+        ds[2] = c + a * z - z * z * z * (1.0f / 3.0f) - (x * x + y * y) * (1.0f + e * z) + f * z * x * x * x;
+    }
+};
+
+// Chen: dx = a(y - x),  dy = (c - a)x - x*z + c*y,  dz = x*y - b*z
+struct ChenField {
+    static constexpr int N = 3;
+    static constexpr float a = 35.0f;
+    float b = 3.0f, c = 28.0f;
+    float u = 0.0f;                     // forcing on dy
+    inline void operator()(const float* s, float* d) const {
+        d[0] = a * (s[1] - s[0]);
+        d[1] = (c - a) * s[0] - s[0] * s[2] + c * s[1] + u;
+        d[2] = s[0] * s[1] - b * s[2];
+    }
+};
+
+// Halvorsen (cyclically symmetric): dx = -a*x - 4y - 4z - y^2, and cyclic
+struct HalvorsenField {
+    static constexpr int N = 3;
+    float a = 1.4f;
+    float u = 0.0f;                     // forcing on dx
+    inline void operator()(const float* s, float* d) const {
+        float x = s[0], y = s[1], z = s[2];
+        d[0] = -a * x - 4.0f * y - 4.0f * z - y * y + u;
+        d[1] = -a * y - 4.0f * z - 4.0f * x - z * z;
+        d[2] = -a * z - 4.0f * x - 4.0f * y - x * x;
+    }
+};
+
+// Sprott A (Nosé–Hoover): dx = y,  dy = -x + y*z,  dz = a - y^2  (a = 1 classic)
+struct SprottAField {
+    static constexpr int N = 3;
+    float a = 1.0f;
+    float u = 0.0f;                     // forcing on dy (driven thermostat oscillator)
+    inline void operator()(const float* s, float* d) const {
+        d[0] = s[1];
+        d[1] = -s[0] + s[1] * s[2] + u;
+        d[2] = a - s[1] * s[1];
+    }
+};
@@ -5,443 +5,129 @@
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
 #include "teensy-chaos/pins.h"
+#include "chaos_algos.h"
+#include "chaos_bench.h"
+#include "ads1115_async.h"
+#include "spsc_ring.h"
+#include "phase_plot.h"
+#include <oled_pager/OledSpiPager.h>
 
 // ─── ADS1115 (Wire1, 0x48) ────────────────────────────────────────────────────
-#define ADS_ADDR     0x48
-#define ADS_REG_CONV 0x00
-#define ADS_REG_CFG  0x01
-
-static bool adsWriteCfg(uint8_t mux) {
-    // OS=1 start, MUX=mux, PGA=001 (±4.096V), MODE=1 single-shot,
-    // DR=111 (860 SPS), COMP_QUE=11 disable comparator
-    uint16_t cfg = 0x8000 | (uint16_t(mux & 0x7) << 12) | 0x0200 | 0x0100 | 0x00E0 | 0x0003;
-    Wire1.beginTransmission(ADS_ADDR);
-    Wire1.write(ADS_REG_CFG);
-    Wire1.write((uint8_t)(cfg >> 8));
-    Wire1.write((uint8_t)(cfg & 0xFF));
-    return Wire1.endTransmission() == 0;
-}
-
-static int16_t adsReadConv() {
-    Wire1.beginTransmission(ADS_ADDR);
-    Wire1.write(ADS_REG_CONV);
-    Wire1.endTransmission(false);
-    Wire1.requestFrom((int)ADS_ADDR, 2);
-    uint8_t msb = Wire1.read();
-    uint8_t lsb = Wire1.read();
-    return (int16_t)((uint16_t(msb) << 8) | lsb);
-}
-
-static void adsReadAll(int16_t out[4]) {
-    for (int ch = 0; ch < 4; ch++) {
-        adsWriteCfg(0b100 + ch);
-        delayMicroseconds(1200);  // 860 SPS → ~1.16ms per conversion
-        out[ch] = adsReadConv();
-    }
-}
-
-// ─── ChaosBase ────────────────────────────────────────────────────────────────
-// Abstract base for all chaotic algorithms. Subclasses populate metadata fields
-// in their constructors and implement the four pure-virtual methods.
-class ChaosBase {
-public:
-    const char* name       = "?";
-    const char* chaosLabel = "c";   // display label for CHAOS param
-    const char* charLabel  = "a";   // display label for CHAR param
-    float chaosMin = 0.0f,   chaosMax = 1.0f;
-    float rateMin  = 0.001f, rateMax  = 0.1f;
-    float charMin  = 0.0f,   charMax  = 1.0f;
-    float modScale = 1.0f;          // chaos-param units per volt of MOD CV
-    float gainL    = 0.12f, gainR = 0.12f;  // pre-tanh amplitude scale
-    float xMin = -1.0f, xRange = 2.0f;     // plot window
-    float yMin = -1.0f, yRange = 2.0f;
-    float cvScaleX = 0.5f, cvScaleY = 0.5f; // state → ±5V CV
-
-    virtual ~ChaosBase() {}
-    virtual void  init()                                          = 0;
-    virtual void  setParams(float chaos, float rate, float charV) = 0;
-    virtual void  stepSample()                                    = 0;
-    virtual float getX() const                                    = 0;
-    virtual float getY() const                                    = 0;
-};
-
-// ─── ChaosRossler ─────────────────────────────────────────────────────────────
-// dx = -y - z,  dy = x + a*y,  dz = b + z*(x - c)
-// CHAOS = c (bifurcation, 2–8),  CHAR = a (spiral tightness, 0.1–0.4)
-class ChaosRossler : public ChaosBase {
-public:
-    ChaosRossler() {
-        name       = "ROSSLER";
-        chaosLabel = "c"; charLabel = "a";
-        chaosMin   = 2.0f;   chaosMax = 8.0f;
-        rateMin    = 0.002f; rateMax  = 0.1f;
-        charMin    = 0.1f;   charMax  = 0.4f;
-        modScale   = 1.0f;
-        gainL      = 0.12f;  gainR    = 0.12f;
-        xMin       = -11.0f; xRange   = 24.0f;
-        yMin       = -11.0f; yRange   = 22.0f;
-        cvScaleX   = 0.50f;  cvScaleY = 0.50f;
-    }
-    void init() override { x_ = 0.1f; y_ = 0.0f; z_ = 0.0f; }
-    void setParams(float chaos, float rate, float charV) override {
-        c_ = chaos; dt_ = rate; a_ = charV;
-    }
-    void stepSample() override {
-        float dx1 = -y_ - z_;
-        float dy1 = x_ + a_*y_;
-        float dz1 = b_ + z_*(x_ - c_);
-        float x2 = x_ + 0.5f*dt_*dx1, y2 = y_ + 0.5f*dt_*dy1, z2 = z_ + 0.5f*dt_*dz1;
-        float dx2 = -y2 - z2, dy2 = x2 + a_*y2, dz2 = b_ + z2*(x2 - c_);
-        float x3 = x_ + 0.5f*dt_*dx2, y3 = y_ + 0.5f*dt_*dy2, z3 = z_ + 0.5f*dt_*dz2;
-        float dx3 = -y3 - z3, dy3 = x3 + a_*y3, dz3 = b_ + z3*(x3 - c_);
-        float x4 = x_ + dt_*dx3, y4 = y_ + dt_*dy3, z4 = z_ + dt_*dz3;
-        float dx4 = -y4 - z4, dy4 = x4 + a_*y4, dz4 = b_ + z4*(x4 - c_);
-        x_ += dt_/6.0f*(dx1 + 2*dx2 + 2*dx3 + dx4);
-        y_ += dt_/6.0f*(dy1 + 2*dy2 + 2*dy3 + dy4);
-        z_ += dt_/6.0f*(dz1 + 2*dz2 + 2*dz3 + dz4);
-    }
-    float getX() const override { return x_; }
-    float getY() const override { return y_; }
-private:
-    float x_ = 0.1f, y_ = 0.0f, z_ = 0.0f;
-    float a_ = 0.2f, b_ = 0.2f, c_ = 5.7f;
-    float dt_ = 0.05f;
-};
-
-// ─── ChaosVanDerPol ───────────────────────────────────────────────────────────
-// dx/dt = y,   dy/dt = mu*(1 - x^2)*y - x
-// CHAOS = mu (nonlinearity, 0.1–8): low = near-sine, high = relaxation osc
-// Start on limit cycle (x=2, y=0) so amplitude is correct from first sample.
-class ChaosVanDerPol : public ChaosBase {
-public:
-    ChaosVanDerPol() {
-        name       = "VAN DER POL";
-        chaosLabel = "u"; charLabel = "a";
-        chaosMin   = 0.1f;   chaosMax = 8.0f;
-        rateMin    = 0.002f; rateMax  = 0.15f;
-        charMin    = 0.0f;   charMax  = 1.0f;  // reserved
-        modScale   = 1.0f;
-        gainL      = 0.45f;  gainR    = 0.20f;
-        xMin       = -3.0f;  xRange   = 6.0f;
-        yMin       = -8.0f;  yRange   = 16.0f;
-        cvScaleX   = 2.00f;  cvScaleY = 0.60f;
-    }
-    void init() override { x_ = 2.0f; y_ = 0.0f; }
-    void setParams(float chaos, float rate, float charV) override {
-        mu_ = chaos;
-        // Cap dt for numerical stability: VdP stiffness ∝ mu; RK4 diverges if dt*mu too large
-        dt_ = fminf(rate, 1.0f / (mu_ + 2.0f));
-        (void)charV;
-    }
-    void stepSample() override {
-        float dx1 = y_;
-        float dy1 = mu_*(1.0f - x_*x_)*y_ - x_;
-        float x2 = x_ + 0.5f*dt_*dx1, y2 = y_ + 0.5f*dt_*dy1;
-        float dx2 = y2, dy2 = mu_*(1.0f - x2*x2)*y2 - x2;
-        float x3 = x_ + 0.5f*dt_*dx2, y3 = y_ + 0.5f*dt_*dy2;
-        float dx3 = y3, dy3 = mu_*(1.0f - x3*x3)*y3 - x3;
-        float x4 = x_ + dt_*dx3, y4 = y_ + dt_*dy3;
-        float dx4 = y4, dy4 = mu_*(1.0f - x4*x4)*y4 - x4;
-        x_ += dt_/6.0f*(dx1 + 2*dx2 + 2*dx3 + dx4);
-        y_ += dt_/6.0f*(dy1 + 2*dy2 + 2*dy3 + dy4);
-        // Safety net: reset if numerics diverge (edge case at extreme mu+dt)
-        if (!isfinite(x_) || !isfinite(y_) || fabsf(x_) > 20.0f) {
-            x_ = 2.0f; y_ = 0.0f;
-        }
-    }
-    float getX() const override { return x_; }
-    float getY() const override { return y_; }
-private:
-    float x_ = 2.0f, y_ = 0.0f;
-    float mu_ = 1.0f, dt_ = 0.05f;
-};
-
-// ─── ChaosLorenz ──────────────────────────────────────────────────────────────
-// dx = sigma*(y-x),  dy = x*(rho-z)-y,  dz = x*y - beta*z
-// CHAOS = rho (bifurcation, 24–32),  CHAR = sigma (8–14)
-// getY() returns z-rho (centred around 0) for both audio and plot.
-class ChaosLorenz : public ChaosBase {
-public:
-    ChaosLorenz() {
-        name       = "LORENZ";
-        chaosLabel = "r"; charLabel = "s";
-        chaosMin   = 24.0f;  chaosMax = 32.0f;
-        rateMin    = 0.001f; rateMax  = 0.003f;
-        charMin    = 6.0f;   charMax  = 14.0f;
-        modScale   = 2.0f;
-        gainL      = 0.05f;  gainR    = 0.05f;
-        xMin       = -20.0f; xRange   = 40.0f;
-        yMin       = -28.0f; yRange   = 55.0f;  // z-rho: ≈ -28 to +27
-        cvScaleX   = 0.25f;  cvScaleY = 0.15f;
-    }
-    void init() override { x_ = 0.1f; y_ = 0.0f; z_ = 0.0f; }
-    void setParams(float chaos, float rate, float charV) override {
-        rho_ = chaos; dt_ = rate; sigma_ = charV;
-    }
-    void stepSample() override {
-        float dx1 = sigma_*(y_ - x_);
-        float dy1 = x_*(rho_ - z_) - y_;
-        float dz1 = x_*y_ - beta_*z_;
-        float x2 = x_ + 0.5f*dt_*dx1, y2 = y_ + 0.5f*dt_*dy1, z2 = z_ + 0.5f*dt_*dz1;
-        float dx2 = sigma_*(y2-x2), dy2 = x2*(rho_-z2)-y2, dz2 = x2*y2-beta_*z2;
-        float x3 = x_ + 0.5f*dt_*dx2, y3 = y_ + 0.5f*dt_*dy2, z3 = z_ + 0.5f*dt_*dz2;
-        float dx3 = sigma_*(y3-x3), dy3 = x3*(rho_-z3)-y3, dz3 = x3*y3-beta_*z3;
-        float x4 = x_ + dt_*dx3, y4 = y_ + dt_*dy3, z4 = z_ + dt_*dz3;
-        float dx4 = sigma_*(y4-x4), dy4 = x4*(rho_-z4)-y4, dz4 = x4*y4-beta_*z4;
-        x_ += dt_/6.0f*(dx1 + 2*dx2 + 2*dx3 + dx4);
-        y_ += dt_/6.0f*(dy1 + 2*dy2 + 2*dy3 + dy4);
-        z_ += dt_/6.0f*(dz1 + 2*dz2 + 2*dz3 + dz4);
-    }
-    float getX() const override { return x_; }
-    float getY() const override { return z_ - rho_; }  // centred: audio + plot
-private:
-    float x_ = 0.1f, y_ = 0.0f, z_ = 0.0f;
-    float sigma_ = 10.0f, beta_ = 2.667f, rho_ = 28.0f;
-    float dt_ = 0.002f;
-};
+// Scanned in the background by Ads1115Async: loop() only polls it. Until a
+// channel's first conversion lands it reads as its 0 V code.
+static Ads1115Async ads;
+static const int16_t kCvZeroCode[4] = {13236, 13240, 13241, 13240};
 
 // ─── AudioChaosEngine ─────────────────────────────────────────────────────────
 // Single AudioStream. setAlgo() swaps the active ChaosBase* at any time;
 // pointer reads/writes are word-sized and atomic on Cortex-M7.
+// Also the producer of the CV stream: each block's CV taps, scaled to volts,
+// go into an SPSC ring that the CV timer drains (popCv()).
+// Input 0 is the line-in forcing signal: with forcing on, each block is
+// converted once, scaled by the algorithm's forceGain, and handed to
+// renderBlock() alongside the output buffers.
+struct CvFrame { float x, y; };     // volts, already clamped
+
+#ifndef CHAOS_FORCE
+#define CHAOS_FORCE 0           // line-in forcing at boot: 0 off, 1 on
+#endif
+
 class AudioChaosEngine : public AudioStream {
 public:
-    AudioChaosEngine() : AudioStream(0, nullptr) {}
+    AudioChaosEngine() : AudioStream(1, inputQueue_) {}
 
     void setAlgo(ChaosBase* a) {
         if (a == algo_) return;
         if (a) a->init();      // initialise state before making live
-        dcL_ = dcR_ = 0.0f;   // flush DC history on switch
+        dcL_.reset(); dcR_.reset();   // flush DC history on switch
         algo_ = a;             // atomic pointer store
     }
 
     ChaosBase* algo() const { return algo_; }
+    void setOversample(uint8_t mode) { osMode_ = mode; }   // OS_ADAPTIVE or 1/2/4/8
+    uint8_t oversample() const { return osMode_; }
+    void setForcing(bool on) { forcing_ = on; }
+    bool forcing() const { return forcing_; }
+    float forcePeak() const { return forcePeak_; }   // last block, full scale = 1
     float getX() const { ChaosBase* a = algo_; return a ? a->getX() : 0.0f; }
     float getY() const { ChaosBase* a = algo_; return a ? a->getY() : 0.0f; }
 
+    // CV consumer side (one context only: the CV timer ISR)
+    bool popCv(CvFrame& f) { return cvRing_.pop(f); }
+    uint32_t cvQueued() const { return cvRing_.size(); }
+    uint32_t cvOverruns() const { return cvOverruns_; }
+
     void update() override {
+        audio_block_t* in = receiveReadOnly(0);   // always taken so it can't go stale
         ChaosBase* a = algo_;   // single atomic load — consistent for this block
-        if (!a) return;
-        audio_block_t* bL = allocate();
-        if (!bL) return;
-        audio_block_t* bR = allocate();
-        if (!bR) { release(bL); return; }
-
-        float gL = a->gainL, gR = a->gainR;
-        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
-            a->stepSample();
-            float outL = tanhf(a->getX() * gL) * 32000.0f;
-            float outR = tanhf(a->getY() * gR) * 32000.0f;
-            outL -= dcL_; dcL_ += outL * 0.0007f;
-            outR -= dcR_; dcR_ += outR * 0.0007f;
-            bL->data[i] = (int16_t)outL;
-            bR->data[i] = (int16_t)outR;
+        audio_block_t* bL = a ? allocate() : nullptr;
+        audio_block_t* bR = bL ? allocate() : nullptr;
+        if (!bR) {
+            if (bL) release(bL);
+            if (in) release(in);
+            return;
+        }
+
+        // Integrate the whole block first, then run each output stage over a
+        // contiguous buffer
+        uint32_t t0 = ARM_DWT_CYCCNT;
+        float xs[AUDIO_BLOCK_SAMPLES], ys[AUDIO_BLOCK_SAMPLES], us[AUDIO_BLOCK_SAMPLES];
+        forceInput(in, a, us);
+        if (in) release(in);
+        cvTap_.n = 0;
+        uint8_t os = a->renderBlock(us, xs, ys, AUDIO_BLOCK_SAMPLES, osMode_, cvTap_);
+        OutputScale sc = outputScale(*a, xs, ys, AUDIO_BLOCK_SAMPLES);
+        for (uint8_t i = 0; i < cvTap_.n; i++) {
+            CvFrame f = { fminf(fmaxf((cvTap_.x[i] - sc.offL) * sc.cvGX, -4.9f), 4.9f),
+                          fminf(fmaxf((cvTap_.y[i] - sc.offR) * sc.cvGY, -4.9f), 4.9f) };
+            if (!cvRing_.push(f)) cvOverruns_++;
         }
+        softClipBlock(xs, AUDIO_BLOCK_SAMPLES, sc.gL, sc.offL);
+        softClipBlock(ys, AUDIO_BLOCK_SAMPLES, sc.gR, sc.offR);
+        dcL_.process(xs, AUDIO_BLOCK_SAMPLES);
+        dcR_.process(ys, AUDIO_BLOCK_SAMPLES);
+        floatToInt16Block(xs, bL->data, AUDIO_BLOCK_SAMPLES, 32000.0f);
+        floatToInt16Block(ys, bR->data, AUDIO_BLOCK_SAMPLES, 32000.0f);
+        uint32_t cyc = ARM_DWT_CYCCNT - t0;
+        a->blockCycles = cyc;
+        if (cyc > a->blockCyclesMax) a->blockCyclesMax = cyc;
+        a->osCycles[os >= 8 ? 3 : os >= 4 ? 2 : os >= 2 ? 1 : 0] = cyc;
+        a->osUsed = os;
+
         transmit(bL, 0); transmit(bR, 1);
         release(bL); release(bR);
     }
 
-private:
-    ChaosBase* algo_ = nullptr;
-    float dcL_ = 0.0f, dcR_ = 0.0f;
-};
-
-// ─── ChaosChua ────────────────────────────────────────────────────────────────
-// Chua circuit — double-scroll attractor.
-// dx = alpha*(y - x - f(x)),  dy = x - y + z,  dz = -beta*y
-// f(x): piecewise-linear Chua diode, negative slope in centre region.
-// CHAOS = alpha (8–16),  CHAR = beta (20–35)
-// Audio: x→L, z→R  (y amplitude is tiny, ~±0.5, not suitable for audio)
-class ChaosChua : public ChaosBase {
-public:
-    ChaosChua() {
-        name       = "CHUA";
-        chaosLabel = "a"; charLabel = "b";
-        chaosMin   = 8.0f;   chaosMax = 11.0f;   // double-scroll bounded ~8.5–10.5
-        rateMin    = 0.001f; rateMax  = 0.008f;
-        charMin    = 12.0f;  charMax  = 16.0f;   // canonical 14.286 near centre
-        modScale   = 1.0f;
-        gainL      = 0.28f;  gainR    = 0.25f;
-        xMin       = -5.0f;  xRange   = 10.0f;
-        yMin       = -6.0f;  yRange   = 12.0f;  // z axis for phase plot
-        cvScaleX   = 1.30f;  cvScaleY = 1.00f;
+    // CPU cycles available per audio block at the current clock
+    static uint32_t blockBudgetCycles() {
+        return (uint32_t)((float)F_CPU_ACTUAL * AUDIO_BLOCK_SAMPLES / AUDIO_SAMPLE_RATE_EXACT);
     }
-    void init() override { x_ = 0.5f; y_ = 0.0f; z_ = 0.0f; }
-    void setParams(float chaos, float rate, float charV) override {
-        alpha_ = chaos; dt_ = rate; beta_ = charV;
-    }
-    void stepSample() override {
-        float h1 = chuaF(x_);
-        float dx1 = alpha_*(y_ - x_ - h1),  dy1 = x_ - y_ + z_,  dz1 = -beta_*y_;
-        float x2 = x_+0.5f*dt_*dx1, y2 = y_+0.5f*dt_*dy1, z2 = z_+0.5f*dt_*dz1;
-        float h2 = chuaF(x2);
-        float dx2 = alpha_*(y2 - x2 - h2), dy2 = x2 - y2 + z2, dz2 = -beta_*y2;
-        float x3 = x_+0.5f*dt_*dx2, y3 = y_+0.5f*dt_*dy2, z3 = z_+0.5f*dt_*dz2;
-        float h3 = chuaF(x3);
-        float dx3 = alpha_*(y3 - x3 - h3), dy3 = x3 - y3 + z3, dz3 = -beta_*y3;
-        float x4 = x_+dt_*dx3, y4 = y_+dt_*dy3, z4 = z_+dt_*dz3;
-        float h4 = chuaF(x4);
-        float dx4 = alpha_*(y4 - x4 - h4), dy4 = x4 - y4 + z4, dz4 = -beta_*y4;
-        x_ += dt_/6.0f*(dx1 + 2*dx2 + 2*dx3 + dx4);
-        y_ += dt_/6.0f*(dy1 + 2*dy2 + 2*dy3 + dy4);
-        z_ += dt_/6.0f*(dz1 + 2*dz2 + 2*dz3 + dz4);
-        // Guard: reset if trajectory escapes the attractor
-        if (!isfinite(x_) || !isfinite(z_) || fabsf(x_) > 8.0f) {
-            x_ = 0.5f; y_ = 0.0f; z_ = 0.0f;
-        }
-    }
-    float getX() const override { return x_; }
-    float getY() const override { return z_; }
-private:
-    inline float chuaF(float x) const {
-        if (x >  1.0f) return m1_*x + (m0_ - m1_);
-        if (x < -1.0f) return m1_*x - (m0_ - m1_);
-        return m0_*x;
-    }
-    float x_ = 0.1f, y_ = 0.0f, z_ = 0.0f;
-    float alpha_ = 9.0f, beta_ = 14.286f;
-    // Standard double-scroll slopes: m0 inner, m1 outer — BOTH must be negative.
-    // With m0=-8/7, m1=-5/7 the system has three equilibria at x=0 and x=±1.5.
-    static constexpr float m0_ = -8.0f / 7.0f;
-    static constexpr float m1_ = -5.0f / 7.0f;
-    float dt_ = 0.005f;
-};
 
-// ─── ChaosDuffing ─────────────────────────────────────────────────────────────
-// Forced nonlinear oscillator — double-well potential with periodic drive.
-// Autonomous 3-variable form: track phase φ = ω·t as a state variable.
-// dx = y,   dy = -δy - αx - βx³ + γcos(φ),   dφ = ω
-// α=-1, β=1 (double-well), δ=0.3 (damping) — fixed.
-// CHAOS = γ (drive amplitude, 0.1–0.8): low = periodic, high = chaotic
-// CHAR  = ω (drive frequency, 0.8–1.4): sets the base pitch
-// Audio: x→L, y→R. Frequency ≈ ω·dt·44100 / 2π Hz.
-class ChaosDuffing : public ChaosBase {
-public:
-    ChaosDuffing() {
-        name       = "DUFFING";
-        chaosLabel = "g"; charLabel  = "w";
-        chaosMin   = 0.1f;   chaosMax = 0.8f;
-        rateMin    = 0.005f; rateMax  = 0.10f;
-        charMin    = 0.8f;   charMax  = 1.4f;
-        modScale   = 0.35f;
-        gainL      = 0.55f;  gainR    = 0.55f;
-        xMin       = -2.0f;  xRange   = 4.0f;
-        yMin       = -2.5f;  yRange   = 5.0f;
-        cvScaleX   = 3.00f;  cvScaleY = 2.50f;
-    }
-    void init() override { x_ = 1.0f; y_ = 0.0f; phi_ = 0.0f; }
-    void setParams(float chaos, float rate, float charV) override {
-        gamma_ = chaos; dt_ = rate; omega_ = charV;
-    }
-    void stepSample() override {
-        float c1 = cosf(phi_);
-        float dx1 = y_;
-        float dy1 = -delta_*y_ - alpha_*x_ - beta_*x_*x_*x_ + gamma_*c1;
-        float x2 = x_+0.5f*dt_*dx1, y2 = y_+0.5f*dt_*dy1;
-        float p2 = phi_ + 0.5f*dt_*omega_;
-        float c2 = cosf(p2);
-        float dx2 = y2;
-        float dy2 = -delta_*y2 - alpha_*x2 - beta_*x2*x2*x2 + gamma_*c2;
-        float x3 = x_+0.5f*dt_*dx2, y3 = y_+0.5f*dt_*dy2;
-        // p3 = p2 (midpoint forcing phase is the same for both RK4 k2 and k3 stages)
-        float c3 = c2;
-        float dx3 = y3;
-        float dy3 = -delta_*y3 - alpha_*x3 - beta_*x3*x3*x3 + gamma_*c3;
-        float x4 = x_+dt_*dx3, y4 = y_+dt_*dy3;
-        float p4 = phi_ + dt_*omega_;
-        float c4 = cosf(p4);
-        float dx4 = y4;
-        float dy4 = -delta_*y4 - alpha_*x4 - beta_*x4*x4*x4 + gamma_*c4;
-        x_   += dt_/6.0f*(dx1 + 2*dx2 + 2*dx3 + dx4);
-        y_   += dt_/6.0f*(dy1 + 2*dy2 + 2*dy3 + dy4);
-        phi_ += dt_*omega_;
-        if (phi_ > 6.28318f) phi_ -= 6.28318f;  // keep phi in [0, 2π)
-    }
-    float getX() const override { return x_; }
-    float getY() const override { return y_; }
 private:
-    float x_ = 1.0f, y_ = 0.0f, phi_ = 0.0f;
-    float gamma_ = 0.4f, omega_ = 1.2f, dt_ = 0.05f;
-    static constexpr float alpha_ = -1.0f;  // double-well: negative linear term
-    static constexpr float beta_  =  1.0f;  // positive cubic term
-    static constexpr float delta_ =  0.3f;  // damping
-};
-
-// ─── ChaosCoupledRossler ──────────────────────────────────────────────────────
-// Two Rössler systems with symmetric x-coupling.
-// dx1 = -y1 - z1 + k(x2-x1),   dy1 = x1 + a·y1,   dz1 = b + z1(x1-c)
-// dx2 = -y2 - z2 + k(x1-x2),   dy2 = x2 + a·y2,   dz2 = b + z2(x2-c)
-// CHAOS = c (bifurcation, 2–8, shared), CHAR = k (coupling, 0.0–0.5)
-// At low k: two detuned oscillators beating. At high k: synchronise.
-// Oscillators start at different ICs to ensure phase diversity.
-// Audio: x1→L, x2→R — true stereo output.
-class ChaosCoupledRossler : public ChaosBase {
-public:
-    ChaosCoupledRossler() {
-        name       = "CPLROSSLER";
-        chaosLabel = "c"; charLabel  = "k";
-        chaosMin   = 2.0f;   chaosMax = 8.0f;
-        rateMin    = 0.002f; rateMax  = 0.10f;
-        charMin    = 0.0f;   charMax  = 0.5f;
-        modScale   = 1.0f;
-        gainL      = 0.10f;  gainR    = 0.10f;
-        xMin       = -13.0f; xRange   = 26.0f;
-        yMin       = -11.0f; yRange   = 22.0f;
-        cvScaleX   = 0.45f;  cvScaleY = 0.45f;
-    }
-    void init() override {
-        x1_=0.1f; y1_=0.0f; z1_=0.0f;
-        x2_=0.5f; y2_=0.2f; z2_=0.0f;  // offset IC for phase diversity
-    }
-    void setParams(float chaos, float rate, float charV) override {
-        c_ = chaos; dt_ = rate; k_ = charV;
-    }
-    void stepSample() override {
-        // Derivatives — both oscillators coupled via x
-        auto deriv = [this](float x1, float y1, float z1,
-                            float x2, float y2, float z2,
-                            float& dx, float& dy, float& dz) {
-            dx = -y1 - z1 + k_*(x2 - x1);
-            dy =  x1 + a_*y1;
-            dz =  b_ + z1*(x1 - c_);
-            (void)y2; (void)z2;
-        };
-        float dx1a, dy1a, dz1a, dx2a, dy2a, dz2a;
-        deriv(x1_,y1_,z1_, x2_,y2_,z2_, dx1a,dy1a,dz1a);
-        deriv(x2_,y2_,z2_, x1_,y1_,z1_, dx2a,dy2a,dz2a);
-
-        float x1b=x1_+0.5f*dt_*dx1a, y1b=y1_+0.5f*dt_*dy1a, z1b=z1_+0.5f*dt_*dz1a;
-        float x2b=x2_+0.5f*dt_*dx2a, y2b=y2_+0.5f*dt_*dy2a, z2b=z2_+0.5f*dt_*dz2a;
-        float dx1b, dy1b, dz1b, dx2b, dy2b, dz2b;
-        deriv(x1b,y1b,z1b, x2b,y2b,z2b, dx1b,dy1b,dz1b);
-        deriv(x2b,y2b,z2b, x1b,y1b,z1b, dx2b,dy2b,dz2b);
-
-        float x1c=x1_+0.5f*dt_*dx1b, y1c=y1_+0.5f*dt_*dy1b, z1c=z1_+0.5f*dt_*dz1b;
-        float x2c=x2_+0.5f*dt_*dx2b, y2c=y2_+0.5f*dt_*dy2b, z2c=z2_+0.5f*dt_*dz2b;
-        float dx1c, dy1c, dz1c, dx2c, dy2c, dz2c;
-        deriv(x1c,y1c,z1c, x2c,y2c,z2c, dx1c,dy1c,dz1c);
-        deriv(x2c,y2c,z2c, x1c,y1c,z1c, dx2c,dy2c,dz2c);
-
-        float x1d=x1_+dt_*dx1c, y1d=y1_+dt_*dy1c, z1d=z1_+dt_*dz1c;
-        float x2d=x2_+dt_*dx2c, y2d=y2_+dt_*dy2c, z2d=z2_+dt_*dz2c;
-        float dx1d, dy1d, dz1d, dx2d, dy2d, dz2d;
-        deriv(x1d,y1d,z1d, x2d,y2d,z2d, dx1d,dy1d,dz1d);
-        deriv(x2d,y2d,z2d, x1d,y1d,z1d, dx2d,dy2d,dz2d);
-
-        x1_ += dt_/6.0f*(dx1a + 2*dx1b + 2*dx1c + dx1d);
-        y1_ += dt_/6.0f*(dy1a + 2*dy1b + 2*dy1c + dy1d);
-        z1_ += dt_/6.0f*(dz1a + 2*dz1b + 2*dz1c + dz1d);
-        x2_ += dt_/6.0f*(dx2a + 2*dx2b + 2*dx2c + dx2d);
-        y2_ += dt_/6.0f*(dy2a + 2*dy2b + 2*dy2c + dy2d);
-        z2_ += dt_/6.0f*(dz2a + 2*dz2b + 2*dz2c + dz2d);
+    // Line-in block → forcing buffer; zeros when off, missing, or the
+    // algorithm takes no forcing
+    void forceInput(const audio_block_t* in, const ChaosBase* a, float* us) {
+        float g = a->forceGain;
+        if (!in || !forcing_ || g == 0.0f) {
+            memset(us, 0, AUDIO_BLOCK_SAMPLES * sizeof(float));
+            forcePeak_ = 0.0f;
+            return;
+        }
+        int16ToFloatBlock(in->data, us, AUDIO_BLOCK_SAMPLES, g * (1.0f / 32768.0f));
+        float pk = 0.0f;
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) pk = fmaxf(pk, fabsf(us[i]));
+        forcePeak_ = pk / fabsf(g);
     }
-    float getX() const override { return x1_; }
-    float getY() const override { return x2_; }
-private:
-    float x1_=0.1f, y1_=0.0f, z1_=0.0f;
-    float x2_=0.5f, y2_=0.2f, z2_=0.0f;
-    float c_=5.7f, k_=0.05f, dt_=0.05f;
-    static constexpr float a_ = 0.2f;
-    static constexpr float b_ = 0.2f;
+
+    audio_block_t* inputQueue_[1];
+    ChaosBase* algo_ = nullptr;
+    volatile uint8_t osMode_ = CHAOS_OVERSAMPLE;
+    volatile bool forcing_ = CHAOS_FORCE;
+    volatile float forcePeak_ = 0.0f;
+    DcBlocker dcL_, dcR_;
+    CvTap cvTap_;
+    SpscRing<CvFrame, 64> cvRing_;  // ~14 ms at 4.41 kHz
+    volatile uint32_t cvOverruns_ = 0;
 };
 
 // ─── Algorithm registry ───────────────────────────────────────────────────────
@@ -451,14 +137,30 @@ ChaosLorenz          algoLorenz;
 ChaosChua            algoChua;
 ChaosDuffing         algoDuffing;
 ChaosCoupledRossler  algoCoupledRossler;
+ChaosPolyRossler     algoPolyRossler;
+ChaosThomas          algoThomas;
+ChaosAizawa          algoAizawa;
+ChaosChen            algoChen;
+ChaosHalvorsen       algoHalvorsen;
+ChaosSprott          algoSprott;
+ChaosLogistic        algoLogistic;
+ChaosHenon           algoHenon;
+ChaosIkeda           algoIkeda;
+ChaosStandard        algoStandard;
+ChaosMandelbrot      algoMandelbrot;
 
 ChaosBase* algos[] = {
     &algoRossler, &algoVanDerPol, &algoLorenz,
-    &algoChua, &algoDuffing, &algoCoupledRossler
+    &algoChua, &algoDuffing, &algoCoupledRossler, &algoPolyRossler,
+    &algoThomas, &algoAizawa, &algoChen, &algoHalvorsen, &algoSprott,
+    &algoLogistic, &algoHenon, &algoIkeda, &algoStandard, &algoMandelbrot
 };
-constexpr uint8_t N_ALGOS = 6;
+constexpr uint8_t N_ALGOS = sizeof(algos) / sizeof(algos[0]);
 
-// ─── Audio graph (single engine, no mixer needed) ─────────────────────────────
+// ─── Audio graph ──────────────────────────────────────────────────────────────
+// Line in (L+R)/2 → engine forcing input; engine → amps → codec
+AudioInputI2S        lineIn;
+AudioMixer4          forceMix;
 AudioChaosEngine     engine;
 AudioAmplifier       ampL;
 AudioAmplifier       ampR;
@@ -467,6 +169,9 @@ AudioAnalyzePeak     peakL;
 AudioAnalyzePeak     peakR;
 AudioControlSGTL5000 codec;
 
+AudioConnection  patchInL  (lineIn,   0, forceMix, 0);
+AudioConnection  patchInR  (lineIn,   1, forceMix, 1);
+AudioConnection  patchForce(forceMix, 0, engine,   0);
 AudioConnection  patchL    (engine, 0, ampL,    0);
 AudioConnection  patchR    (engine, 1, ampR,    0);
 AudioConnection  patchConnL(ampL,   0, audioOut, 0);
@@ -475,7 +180,28 @@ AudioConnection  patchPeakL(ampL,   0, peakL,   0);
 AudioConnection  patchPeakR(ampR,   0, peakR,   0);
 
 // ─── OLED ─────────────────────────────────────────────────────────────────────
+// Top 32 rows: incremental phase plot (phase_plot.h). Bottom: three text rows,
+// each redrawn only when its text changes. Nothing calls display.display()
+// after setup: oledPager sends changed pages by SPI DMA from loop().
+#define OLED_FRAME_MS   25      // 40 fps trail
+#define OLED_TEXT_DIV   4       // text rows every 4th frame (10 fps)
+#define PLOT_SAMPLE_US  2000    // trail point spacing: 256 segments ≈ 0.5 s
+#define PLOT_PEND       32      // points queued between frames
+
 Adafruit_SSD1306 display(128, 64, &SPI, OLED_DC, OLED_RST, OLED_CS);
+static oled_pager::OledSpiPager oledPager(display, OLED_CS, OLED_DC);
+static PhasePlot plot;
+static uint32_t oledFrameUsMax = 0;
+static char oledRows[3][24];
+
+static void oledTextRow(uint8_t row, const char* text) {
+    if (strcmp(text, oledRows[row]) == 0) return;
+    snprintf(oledRows[row], sizeof(oledRows[row]), "%s", text);
+    int16_t y = 34 + 10 * row;
+    display.fillRect(0, y, 128, 8, SSD1306_BLACK);
+    display.setCursor(0, y);
+    display.print(text);
+}
 
 // ─── MCP4822 DAC ──────────────────────────────────────────────────────────────
 // Calibrated: Vout = code * 0.002431 − 4.972 (both channels, ±10mV)
@@ -497,6 +223,71 @@ void dacWriteVolts(uint8_t ch, float volts) {
     dacWrite(ch, (uint16_t)constrain(code, 0, 4095));
 }
 
+// ─── CV output timer ──────────────────────────────────────────────────────────
+// Drains the engine's CV ring to the DAC at exactly the tap rate (audio rate /
+// CHAOS_CV_DIV), so the X/Y jacks are evenly sampled copies of the attractor
+// regardless of what loop() is doing. Runs above the audio ISR priority.
+// Latency is held at ~one audio block plus margin: the timer waits for
+// CV_PRIME frames after an underrun, and skips ahead if OLED SPI traffic
+// (which masks this IRQ through SPI.usingInterrupt) has let the ring fill.
+static IntervalTimer cvTimer;
+static constexpr uint32_t CV_PRIME = CvTap::MAX + 4;
+static constexpr uint32_t CV_HIGH  = 2 * CV_PRIME;
+static volatile uint32_t cvUnderruns = 0, cvSkipped = 0;
+
+static void cvTimerIsr() {
+    static bool primed = false;
+    if (!primed) {
+        if (engine.cvQueued() < CV_PRIME) return;
+        primed = true;
+    }
+    CvFrame f;
+    while (engine.cvQueued() > CV_HIGH) { engine.popCv(f); cvSkipped++; }
+    if (!engine.popCv(f)) { cvUnderruns++; primed = false; return; }   // hold last value
+    dacWriteVolts(0, f.x);
+    dacWriteVolts(1, f.y);
+}
+
+// ─── Block cost report ────────────────────────────────────────────────────────
+// Every 5 s with a terminal open: last and peak cycles per audio block for
+// every algorithm that has run, as a share of the 128-sample budget.
+static void printCycleReport() {
+    uint32_t budget = AudioChaosEngine::blockBudgetCycles();
+    Serial.printf("[chaos] budget %lu cyc/blk, audio cpu %.1f%% (peak %.1f%%)\n",
+                  budget, AudioProcessorUsage(), AudioProcessorUsageMax());
+    ChaosBase* cur = engine.algo();
+    if (engine.oversample() == OS_ADAPTIVE) Serial.printf("[chaos] oversampling adaptive, now x%u\n", cur ? cur->osUsed : 1);
+    else Serial.printf("[chaos] oversampling x%u\n", engine.oversample());
+    for (uint8_t i = 0; i < N_ALGOS; i++) {
+        ChaosBase* a = algos[i];
+        uint32_t last = a->blockCycles, peak = a->blockCyclesMax;
+        if (!peak) continue;
+        Serial.printf("[chaos]   %-11s %-5s %7lu cyc/blk (%.1f%%)  peak %7lu (%.1f%%)  os", a->name,
+                      a->integName, last, 100.0f * last / budget, peak, 100.0f * peak / budget);
+        for (uint8_t k = 0; k < 4; k++) {
+            if (a->osCycles[k]) Serial.printf(" x%u:%.1f%%", 1u << k, 100.0f * a->osCycles[k] / budget);
+        }
+        if (a->guardResets) Serial.printf("  guard resets %lu", a->guardResets);
+        Serial.println();
+        a->blockCyclesMax = 0;
+    }
+    if (engine.forcing()) Serial.printf("[chaos] line-in forcing on, gain %.3f, input peak %.2f\n",
+                                        cur ? cur->forceGain : 0.0f, engine.forcePeak());
+    Serial.printf("[chaos] cv %.0f Hz, queued %lu, underruns %lu, skipped %lu, overruns %lu\n",
+                  AUDIO_SAMPLE_RATE_EXACT / CHAOS_CV_DIV, engine.cvQueued(), cvUnderruns, cvSkipped,
+                  engine.cvOverruns());
+    Serial.printf("[chaos] oled %lu pages, page max %lu us, frame max %lu us\n",
+                  oledPager.pagesSent(), oledPager.maxPageUs(), oledFrameUsMax);
+    oledPager.statsReset(); oledFrameUsMax = 0;
+    static uint32_t lastConv = 0;
+    uint32_t conv = ads.conversions();
+    uint32_t age = micros() - ads.stampUs(3);
+    Serial.printf("[chaos] ads1115 %lu conv in window, %lu errors, RST age %lu us\n",
+                  conv - lastConv, ads.errors(), age);
+    lastConv = conv;
+    AudioProcessorUsageMaxReset();
+}
+
 // ─── setup ────────────────────────────────────────────────────────────────────
 void setup() {
     pinMode(10, OUTPUT);
@@ -507,8 +298,9 @@ void setup() {
 
     Wire1.setSDA(17); Wire1.setSCL(16);
     Wire1.begin(); Wire1.setClock(400000);
+    ads.begin(Wire1, 0x48, PIN_ADS_RDY);
 
-    AudioMemory(12);   // one stereo engine: 12 blocks is comfortable
+    AudioMemory(16);   // stereo engine + line-in forcing path
 
     codec.enable();
     codec.inputSelect(AUDIO_INPUT_LINEIN);
@@ -517,6 +309,8 @@ void setup() {
     codec.lineOutLevel(29);
     ampL.gain(1.0f);
     ampR.gain(1.0f);
+    forceMix.gain(0, 0.5f);
+    forceMix.gain(1, 0.5f);
 
     pinMode(PIN_BTN, INPUT_PULLUP);
     pinMode(PIN_CS_DAC, OUTPUT);
@@ -525,8 +319,17 @@ void setup() {
     display.begin(SSD1306_SWITCHCAPVCC);
     display.clearDisplay();
     display.display();
+    display.setTextSize(1);
+    display.setTextColor(SSD1306_WHITE);
+    plot.begin(display.getBuffer());
+    oledPager.begin(SPI, 8000000);
 
     engine.setAlgo(algos[0]);   // start with Rössler
+
+    // DAC shares SPI with the OLED: mask the CV timer during OLED transactions
+    SPI.usingInterrupt(IRQ_PIT);
+    cvTimer.priority(64);
+    cvTimer.begin(cvTimerIsr, 1.0e6f * CHAOS_CV_DIV / AUDIO_SAMPLE_RATE_EXACT);
 }
 
 // ─── loop ─────────────────────────────────────────────────────────────────────
@@ -537,9 +340,10 @@ void loop() {
     int p3 = readPot(PIN_CHAR);
     int p4 = readPot(PIN_DEPTH);
 
-    // CV inputs (ADS1115)
+    // CV inputs (ADS1115): latest completed conversion per channel
+    ads.poll();
     int16_t cv[4];
-    adsReadAll(cv);
+    for (uint8_t ch = 0; ch < 4; ch++) cv[ch] = ads.stampUs(ch) ? ads.value(ch) : kCvZeroCode[ch];
 
     // Algorithm selection — button cycles through all algorithms
     static uint8_t  algoIdx   = 0;
@@ -571,7 +375,7 @@ void loop() {
                           algo->chaosMin - 2.0f, algo->chaosMax + 2.0f);
         rate  = constrain(rate * powf(2.0f, clkVolts + asgnVolts),
                           algo->rateMin * 0.5f, algo->rateMax * 2.0f);
-        algo->setParams(chaos, rate, charV);
+        algo->post({chaos, rate, charV});
     }
 
     float depth = 0.1f + (p4 / 1023.0f) * 0.9f;
@@ -585,65 +389,93 @@ void loop() {
     }
     lastRst = cv[3];
 
-    // Phase plot ring buffer — sampled every loop iteration
-    #define PLOT_W  128
-    #define PLOT_H   32
-    #define TRAIL    96
-    static uint8_t trailX[TRAIL], trailY[TRAIL];
-    static uint8_t trailHead = 0;
-    if (algo) {
-        float px = (engine.getX() - algo->xMin) * (PLOT_W - 1) / algo->xRange;
-        float py = (engine.getY() - algo->yMin) * (PLOT_H - 1) / algo->yRange;
-        trailX[trailHead] = (uint8_t)constrain(px, 0, PLOT_W - 1);
-        trailY[trailHead] = (uint8_t)constrain(PLOT_H - 1 - py, 0, PLOT_H - 1);
-        trailHead = (trailHead + 1) % TRAIL;
-    }
-
-    // Display update (~10 fps)
-    static uint32_t lastDisp = 0;
-    if (millis() - lastDisp > 100) {
-        lastDisp = millis();
-        display.clearDisplay();
-
-        // Phase space plot (top 32 rows)
-        for (uint8_t i = 0; i < TRAIL; i++) {
-            display.drawPixel(trailX[i], trailY[i], SSD1306_WHITE);
+    // Phase plot: the attractor is sampled every PLOT_SAMPLE_US into a small
+    // queue; each frame turns the queued points into trail segments
+    static uint8_t  pendX[PLOT_PEND], pendY[PLOT_PEND];
+    static uint8_t  pendN = 0;
+    static uint32_t lastSample = 0;
+    static ChaosBase* plotAlgo = nullptr;
+    if (algo != plotAlgo) { plot.clear(); pendN = 0; plotAlgo = algo; }   // new plot window
+    if (algo && micros() - lastSample >= PLOT_SAMPLE_US && pendN < PLOT_PEND) {
+        lastSample = micros();
+        float xMin = algo->xMin, xRange = algo->xRange, yMin = algo->yMin, yRange = algo->yRange;
+        if (algo->autoNorm) {
+            xMin = algo->rangeX.lo; xRange = fmaxf(algo->rangeX.hi - xMin, AutoRange::kMinSpan);
+            yMin = algo->rangeY.lo; yRange = fmaxf(algo->rangeY.hi - yMin, AutoRange::kMinSpan);
         }
+        float px = (engine.getX() - xMin) * (PhasePlot::W - 1) / xRange;
+        float py = (engine.getY() - yMin) * (PhasePlot::H - 1) / yRange;
+        pendX[pendN] = (uint8_t)constrain(px, 0, PhasePlot::W - 1);
+        pendY[pendN] = (uint8_t)constrain(PhasePlot::H - 1 - py, 0, PhasePlot::H - 1);
+        pendN++;
+    }
 
-        display.setTextSize(1);
-        display.setTextColor(SSD1306_WHITE);
-
-        if (algo) {
+    // Display frame: new trail segments every frame, text rows every
+    // OLED_TEXT_DIV frames. The pager then sends whichever pages changed.
+    static uint32_t lastFrame = 0;
+    static uint8_t  textDiv = 0;
+    if (millis() - lastFrame >= OLED_FRAME_MS) {
+        lastFrame = millis();
+        uint32_t t0 = micros();
+        for (uint8_t i = 0; i < pendN; i++) plot.push(pendX[i], pendY[i]);
+        pendN = 0;
+
+        if (algo && ++textDiv >= OLED_TEXT_DIV) {
+            textDiv = 0;
+            char left[16], row[32];
             // Row 1: algorithm name + chaos param
-            display.setCursor(0, 34);
-            display.print(algo->name);
-            display.setCursor(72, 34);
-            display.print(algo->chaosLabel); display.print(':');
-            display.print(chaos, 1);
-
+            snprintf(row, sizeof(row), "%-12.12s%s:%.1f", algo->name, algo->chaosLabel, chaos);
+            oledTextRow(0, row);
             // Row 2: char param + rate
-            display.setCursor(0, 44);
-            display.print(algo->charLabel); display.print(':');
-            display.print(charV, 2);
-            display.setCursor(72, 44);
-            display.print("dt:"); display.print(rate, 4);
-
-            // Row 3: depth + peak levels
+            snprintf(left, sizeof(left), "%s:%.2f", algo->charLabel, charV);
+            snprintf(row, sizeof(row), "%-12sdt:%.4f", left, rate);
+            oledTextRow(1, row);
+            // Row 3: depth + peak levels + oversampling (x = fixed, a = adaptive)
             float lv = peakL.available() ? peakL.read() : 0.0f;
             float rv = peakR.available() ? peakR.read() : 0.0f;
-            display.setCursor(0, 54);
-            display.print("dp:"); display.print(depth, 2);
-            display.setCursor(72, 54);
-            display.print("L"); display.print((int)(lv * 9));
-            display.print(" R"); display.print((int)(rv * 9));
+            char mid[12];
+            snprintf(left, sizeof(left), "dp:%.2f", depth);
+            snprintf(mid, sizeof(mid), "L%d R%d", (int)(lv * 9), (int)(rv * 9));
+            if (algo->isMap) snprintf(row, sizeof(row), "%-12s%-6s%s", left, mid, kInterpName[mapInterp]);
+            else snprintf(row, sizeof(row), "%-12s%-6s%c%u", left, mid,
+                          engine.oversample() == OS_ADAPTIVE ? 'a' : 'x', (unsigned)algo->osUsed);
+            oledTextRow(2, row);
         }
-
-        display.display();
+        uint32_t us = micros() - t0;
+        if (us > oledFrameUsMax) oledFrameUsMax = us;
+    }
+    oledPager.poll();
+
+    // Serial keys: 'b' integrator benchmark (stalls loop ~0.3 s),
+    // '1' '2' '4' '8' fixed oversampling, 'a' adaptive,
+    // 'x' 'y' next POLY ROSS voice on that CV jack, 'i' map interpolation,
+    // 'f' line-in forcing on/off, '+' '-' forcing gain of the active algorithm
+    if (Serial.available()) {
+        int c = Serial.read();
+        if (c == 'b') chaosBenchRun(Serial);
+        else if (c == 'i') {
+            mapInterp = (uint8_t)((mapInterp + 1) % INTERP_COUNT);
+            Serial.printf("[chaos] map interpolation %s\n", kInterpName[mapInterp]);
+        }
+        else if (c == 'x' || c == 'y') {
+            uint8_t v = algoPolyRossler.cycleCvVoice(c == 'y');
+            Serial.printf("[chaos] cv %c <- poly voice %u\n", c, v);
+        }
+        else if (c == 'f') {
+            engine.setForcing(!engine.forcing());
+            Serial.printf("[chaos] line-in forcing %s\n", engine.forcing() ? "on" : "off");
+        }
+        else if ((c == '+' || c == '-') && algo && algo->forceGain != 0.0f) {
+            algo->forceGain *= (c == '+') ? 1.41421356f : 0.70710678f;   // ±3 dB
+            Serial.printf("[chaos] %s forcing gain %.3f\n", algo->name, algo->forceGain);
+        }
+        else if (c == 'a') engine.setOversample(OS_ADAPTIVE);
+        else if (c == '1' || c == '2' || c == '4' || c == '8') engine.setOversample((uint8_t)(c - '0'));
     }
 
-    // CV outputs: active algorithm state → X and Y jacks
-    if (algo) {
-        dacWriteVolts(0, constrain(engine.getX() * algo->cvScaleX, -4.9f, 4.9f));
-        dacWriteVolts(1, constrain(engine.getY() * algo->cvScaleY, -4.9f, 4.9f));
+    static uint32_t lastReport = 0;
+    if (millis() - lastReport >= 5000) {
+        lastReport = millis();
+        if (Serial) printCycleReport();
     }
 }
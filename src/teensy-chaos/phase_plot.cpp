@@ -0,0 +1,51 @@
+#include "phase_plot.h"
+#include <string.h>
+
+static constexpr int RING = PhasePlot::TRAIL + 1;
+
+void PhasePlot::clear() {
+    memset(count_, 0, sizeof(count_));
+    memset(fb_ + (y0_ / 8) * W, 0, W * H / 8);
+    head_ = 0; points_ = 0;
+}
+
+inline void PhasePlot::plot(int x, int y, bool add) {
+    uint16_t& c = count_[y * W + x];
+    int row = y0_ + y;
+    uint8_t& byte = fb_[(row >> 3) * W + x];
+    uint8_t bit = (uint8_t)(1u << (row & 7));
+    if (add) { if (c++ == 0) byte |= bit; }
+    else if (c && --c == 0) byte &= (uint8_t)~bit;
+}
+
+// Bresenham; add and erase visit exactly the same pixels
+void PhasePlot::line(int x0, int y0, int x1, int y1, bool add) {
+    int dx = x1 > x0 ? x1 - x0 : x0 - x1, sx = x0 < x1 ? 1 : -1;
+    int dy = y1 > y0 ? y0 - y1 : y1 - y0, sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    for (;;) {
+        plot(x0, y0, add);
+        if (x0 == x1 && y0 == y1) break;
+        int e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+}
+
+void PhasePlot::push(uint8_t x, uint8_t y) {
+    if (x >= W) x = W - 1;
+    if (y >= H) y = H - 1;
+    if (points_ == RING) {
+        // Drop the oldest segment (oldest point → the one after it)
+        int t = (head_ + RING - points_) % RING, t1 = (t + 1) % RING;
+        line(px_[t], py_[t], px_[t1], py_[t1], false);
+        points_--;
+    }
+    if (points_) {
+        int last = (head_ + RING - 1) % RING;
+        line(px_[last], py_[last], x, y, true);
+    }
+    px_[head_] = x; py_[head_] = y;
+    head_ = (uint16_t)((head_ + 1) % RING);
+    points_++;
+}
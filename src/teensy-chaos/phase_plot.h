@@ -0,0 +1,33 @@
+#pragma once
+#include <stdint.h>
+
+// Incremental phase-space trail drawn straight into an SSD1306 framebuffer
+// (page-major, 1 bit per pixel, rotation 0). The trail is a ring of TRAIL
+// line segments: push() draws the segment to the new point and erases the
+// oldest one, so a frame touches two short lines instead of the whole plot.
+//
+// Crossing segments share pixels, so each pixel of the plot area keeps a
+// coverage count; a pixel is only cleared when the last segment over it goes.
+// Which pages changed is left to the flush (OledSpiPager compares pages).
+class PhasePlot {
+public:
+    static constexpr int W = 128, H = 32;
+    static constexpr int TRAIL = 256;       // segments
+
+    // fb: framebuffer W wide (after oled.begin() has allocated it); the plot
+    // occupies rows y0..y0+H-1, y0 a multiple of 8. Clears the area.
+    void begin(uint8_t* fb, int y0 = 0) { fb_ = fb; y0_ = y0; clear(); }
+
+    void clear();                           // empty trail, blank the plot area
+    void push(uint8_t x, uint8_t y);        // x < W, y < H
+
+private:
+    void line(int x0, int y0, int x1, int y1, bool add);
+    inline void plot(int x, int y, bool add);
+
+    uint8_t* fb_ = nullptr;
+    int y0_ = 0;
+    uint16_t count_[W * H] = {};
+    uint8_t  px_[TRAIL + 1], py_[TRAIL + 1];   // points; segment i = pt i → i+1
+    uint16_t head_ = 0, points_ = 0;
+};
@@ -0,0 +1,38 @@
+#pragma once
+#include <stdint.h>
+
+// Single-producer / single-consumer ring of N (power of two) items. One side
+// may run in an interrupt that preempts the other; head_ is only written by
+// push(), tail_ only by pop(), and each publishes after the item it guards.
+// Single-core only (the barrier is a compiler barrier). No Arduino deps.
+template <class T, uint32_t N>
+class SpscRing {
+    static_assert(N && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+public:
+    // Producer side. False (item dropped) if full.
+    bool push(const T& v) {
+        uint32_t h = head_;
+        if (h - tail_ == N) return false;
+        buf_[h & (N - 1)] = v;
+        __asm__ volatile("" ::: "memory");
+        head_ = h + 1;
+        return true;
+    }
+
+    // Consumer side. False if empty.
+    bool pop(T& v) {
+        uint32_t t = tail_;
+        if (head_ == t) return false;
+        v = buf_[t & (N - 1)];
+        __asm__ volatile("" ::: "memory");
+        tail_ = t + 1;
+        return true;
+    }
+
+    uint32_t size() const { return head_ - tail_; }
+    static constexpr uint32_t capacity() { return N; }
+
+private:
+    T buf_[N];
+    volatile uint32_t head_ = 0, tail_ = 0;
+};
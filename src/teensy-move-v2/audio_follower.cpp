@@ -0,0 +1,132 @@
+#include "audio_follower.h"
+
+static const float kBlockRate   = AUDIO_SAMPLE_RATE_EXACT / AUDIO_BLOCK_SAMPLES;
+static const float kFromInt16   = 1.0f / 32768.0f;
+static const float kLpK         = 0.13f;    // ~1 kHz one-pole ahead of the zero-crossing tracker
+static const float kMinPitchHz  = 30.0f, kMaxPitchHz = 1500.0f;
+static const float kSlowHfK     = 0.03f;    // ~100 ms HF energy reference
+static const uint16_t kRefractoryBlocks = 17;  // ~50 ms between onsets
+static const float kOnsetFloor  = 1e-5f;    // ignore onsets in near-silence
+
+static inline float blockCoef(float ms) {
+  float blocks = ms * 0.001f * kBlockRate;
+  return blocks <= 1.0f ? 1.0f : 1.0f - expf(-1.0f / blocks);
+}
+
+AudioFollower::AudioFollower() : AudioStream(2, inputQueueArray_) {
+  attack(5.0f);
+  release(150.0f);
+}
+
+void AudioFollower::attack(float ms) { attackK_ = blockCoef(ms); }
+void AudioFollower::release(float ms) { releaseK_ = blockCoef(ms); }
+void AudioFollower::onsetThreshold(float ratio) { onsetRatio_ = ratio < 1.5f ? 1.5f : ratio; }
+
+bool AudioFollower::read(FollowerFrame& out, uint32_t& lastSeq) const {
+  uint32_t s1, s2;
+  do {
+    s1 = seq_;
+    if (s1 == lastSeq) return false;
+    __asm__ volatile("" ::: "memory");
+    out = mailbox_;
+    __asm__ volatile("" ::: "memory");
+    s2 = seq_;
+  } while (s1 != s2 || (s1 & 1));
+  lastSeq = s1;
+  return true;
+}
+
+void AudioFollower::publish() {
+  seq_ = seq_ + 1;            // odd: writing
+  __asm__ volatile("" ::: "memory");
+  mailbox_ = out_;
+  __asm__ volatile("" ::: "memory");
+  seq_ = seq_ + 1;            // even: stable
+}
+
+void AudioFollower::update() {
+  audio_block_t* a = receiveReadOnly(0);
+  audio_block_t* b = receiveReadOnly(1);
+  if (!enabled_) {            // still drain the inputs so they don't stall
+    if (a) AudioStream::release(a);
+    if (b) AudioStream::release(b);
+    return;
+  }
+
+  const int16_t* l = a ? a->data : (b ? b->data : nullptr);
+  const int16_t* r = b ? b->data : l;
+  float sumSq = 0.0f, hfSq = 0.0f, pk = peak_ * 0.995f;
+
+  for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+    float x = l ? (l[i] + r[i]) * (0.5f * kFromInt16) : 0.0f;
+    float d = x - prevX_; prevX_ = x;
+    sumSq += x * x; hfSq += d * d;
+
+    // Pitch: Schmitt-triggered rising crossings of the low-passed signal
+    // (armed below -h, the next rising zero crossing counts and disarms),
+    // sub-sample position by linear interpolation
+    lp_ += kLpK * (x - lp_);
+    float ax = fabsf(lp_); if (ax > pk) pk = ax;
+    float h = pk * 0.15f;
+    if (lp_ < -h) armed_ = true;
+    if (armed_ && prevLp_ <= 0.0f && lp_ > 0.0f) {
+      armed_ = false;
+      float t = sampleCount_ + i - 1 + prevLp_ / (prevLp_ - lp_);
+      if (hasCross_) {
+        float p = t - lastCross_;
+        if (p > AUDIO_SAMPLE_RATE_EXACT / kMaxPitchHz && p < AUDIO_SAMPLE_RATE_EXACT / kMinPitchHz) {
+          if (!periodsSeen_) { periodAvg_ = p; periodDev_ = 0.0f; }
+          float e = p - periodAvg_;
+          periodAvg_ += 0.3f * e;
+          periodDev_ += 0.3f * (fabsf(e) - periodDev_);
+          if (periodsSeen_ < 255) periodsSeen_++;
+        }
+      }
+      lastCross_ = t; hasCross_ = true;
+    }
+    prevLp_ = lp_;
+  }
+  if (a) AudioStream::release(a);
+  if (b) AudioStream::release(b);
+  peak_ = pk;
+  sampleCount_ += AUDIO_BLOCK_SAMPLES;
+  // Rebase timestamps well before the float mantissa runs out
+  if (sampleCount_ > (1u << 20)) {
+    if (hasCross_) lastCross_ -= (float)sampleCount_;
+    sampleCount_ = 0;
+  }
+  // No crossing for two periods of the lowest pitch: unvoiced
+  if (hasCross_ && sampleCount_ - lastCross_ > 2.0f * AUDIO_SAMPLE_RATE_EXACT / kMinPitchHz) {
+    periodsSeen_ = 0; hasCross_ = false;
+  }
+
+  // Envelope (block RMS, asymmetric one-pole)
+  float rms = sqrtf(sumSq * (1.0f / AUDIO_BLOCK_SAMPLES));
+  env_ += (rms > env_ ? attackK_ : releaseK_) * (rms - env_);
+
+  // Brightness: first-difference energy vs total (0 for DC, ~1 for noise)
+  float ratio = sumSq > 1e-9f ? hfSq / (2.0f * sumSq) : 0.0f;
+  bright_ += 0.2f * ((ratio > 1.0f ? 1.0f : ratio) - bright_);
+
+  // Onsets: HF energy jump against its own slow average
+  float hf = hfSq * (1.0f / AUDIO_BLOCK_SAMPLES);
+  if (refractory_) refractory_--;
+  if (!refractory_ && hf > kOnsetFloor && hf > slowHf_ * onsetRatio_) {
+    float s = (hf / (slowHf_ * onsetRatio_ + 1e-12f) - 1.0f) * 0.25f;
+    out_.onsetStrength = s > 1.0f ? 1.0f : s;
+    out_.onsets++;
+    refractory_ = kRefractoryBlocks;
+  }
+  slowHf_ += kSlowHfK * (hf - slowHf_);
+
+  out_.env = env_ > 1.0f ? 1.0f : env_;
+  out_.bright = bright_;
+  if (periodsSeen_ >= 3 && periodAvg_ > 0.0f) {
+    float conf = 1.0f - 4.0f * periodDev_ / periodAvg_;
+    out_.pitchConf = conf < 0.0f ? 0.0f : conf;
+    if (out_.pitchConf > 0.5f) out_.pitchHz = AUDIO_SAMPLE_RATE_EXACT / periodAvg_;
+  } else {
+    out_.pitchConf *= 0.8f;
+  }
+  publish();
+}
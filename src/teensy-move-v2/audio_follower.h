@@ -0,0 +1,61 @@
+#pragma once
+#include <Arduino.h>
+#include <Audio.h>
+
+// Audio -> CV analysis stage.
+// Runs once per audio block inside the Audio library update: envelope
+// follower, onset (transient) detector, brightness and a zero-crossing pitch
+// tracker on the L+R sum. Results are published per block through a
+// sequence-counted mailbox; the control side picks up the latest frame.
+
+struct FollowerFrame {
+  float    env;            // smoothed RMS, 0..1 full scale
+  float    bright;         // high-frequency share, 0..1
+  float    pitchHz;        // last confident pitch (held while unvoiced)
+  float    pitchConf;      // 0..1 period consistency
+  float    onsetStrength;  // 0..1 of the most recent onset
+  uint32_t onsets;         // running onset count (compare to detect new ones)
+};
+
+class AudioFollower : public AudioStream {
+public:
+  AudioFollower();
+
+  void enable(bool on) { enabled_ = on; }
+  bool enabled() const { return enabled_; }
+  void attack(float ms);                 // envelope attack / release
+  void release(float ms);
+  void onsetThreshold(float ratio);      // fast/slow HF energy ratio (default 4)
+
+  // Latest frame. Seqlock read: call from loop() only — the writer (audio
+  // update) can preempt the reader, never the other way round.
+  // Returns false if nothing new since lastSeq.
+  bool read(FollowerFrame& out, uint32_t& lastSeq) const;
+
+  void update() override;
+
+private:
+  void publish();
+
+  audio_block_t* inputQueueArray_[2];
+  volatile bool enabled_ = false;
+
+  // Block-rate state
+  float env_ = 0.0f, attackK_ = 0.0f, releaseK_ = 0.0f;
+  float slowHf_ = 0.0f, onsetRatio_ = 4.0f;
+  uint16_t refractory_ = 0;
+  float bright_ = 0.0f;
+
+  // Pitch tracker (sample-rate state)
+  float lp_ = 0.0f, prevLp_ = 0.0f, prevX_ = 0.0f, peak_ = 0.0f;
+  bool  armed_ = false;                  // went below -h since the last crossing
+  uint32_t sampleCount_ = 0;
+  float lastCross_ = 0.0f;               // may go negative after a rebase
+  bool  hasCross_ = false;
+  float periodAvg_ = 0.0f, periodDev_ = 0.0f;
+  uint8_t periodsSeen_ = 0;
+
+  FollowerFrame out_ = {};
+  volatile uint32_t seq_ = 0;
+  FollowerFrame mailbox_ = {};
+};
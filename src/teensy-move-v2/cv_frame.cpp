@@ -0,0 +1,126 @@
+#include "cv_frame.h"
+#include <SPI.h>
+#include "spi_bus.h"
+#include "profile.h"
+
+static const CvPort* g_ports = nullptr;
+static uint8_t g_portCount = 0;
+static IntervalTimer g_frameTimer;
+
+static volatile float    g_target[CV_FRAME_MAX_PORTS];
+static volatile uint8_t  g_pending = 0;          // bit per port
+static volatile bool     g_enabled = true;
+static uint16_t          g_lastCode[CV_FRAME_MAX_PORTS];
+static const uint16_t    kNoCode = 0xFFFF;       // forces the next write
+
+static volatile uint32_t g_ticks = 0, g_writes = 0, g_coalesced = 0, g_maxCyc = 0;
+
+static const SPISettings kDacSpi(4000000, MSBFIRST, SPI_MODE0);
+
+static void frameIsr(){
+  if (!g_enabled || !g_pending) return;
+  uint32_t t0 = ARM_DWT_CYCCNT;
+
+  __disable_irq();
+  uint8_t pend = g_pending; g_pending = 0;
+  float v[CV_FRAME_MAX_PORTS];
+  for (uint8_t i = 0; i < g_portCount; i++) if (pend & (1u << i)) v[i] = g_target[i];
+  __enable_irq();
+
+  // Convert once per changed output, drop writes that land on the same code
+  uint16_t word[CV_FRAME_MAX_PORTS]; uint8_t idx[CV_FRAME_MAX_PORTS]; uint8_t n = 0;
+  for (uint8_t i = 0; i < g_portCount; i++) {
+    if (!(pend & (1u << i))) continue;
+    const CvPort& p = g_ports[i];
+    uint16_t code = p.toCode(p.calCh, v[i]);
+    if (code == g_lastCode[i]) continue;
+    g_lastCode[i] = code;
+    word[n] = frame4822(p.dacCh, code); idx[n] = i; n++;
+  }
+  if (!n) return;
+
+  SPI.beginTransaction(kDacSpi);
+  for (uint8_t k = 0; k < n; k++) {
+    const CvPort& p = g_ports[idx[k]];
+    if (p.csPin == CV_PORT_EXPANDER) {
+      expanderDacWriteLocked(p.expCsBit, word[k]);
+    } else {
+      digitalWriteFast(p.csPin, LOW);
+      SPI.transfer16(word[k]);
+      digitalWriteFast(p.csPin, HIGH);
+    }
+  }
+  SPI.endTransaction();
+
+  g_ticks++; g_writes += n;
+  uint32_t cyc = ARM_DWT_CYCCNT - t0;
+  if (cyc > g_maxCyc) g_maxCyc = cyc;
+}
+
+void cvFrameBegin(const CvPort* ports, uint8_t count){
+  if (count > CV_FRAME_MAX_PORTS) count = CV_FRAME_MAX_PORTS;
+  g_ports = ports; g_portCount = count;
+  for (uint8_t i = 0; i < count; i++) { g_target[i] = 0.0f; g_lastCode[i] = kNoCode; }
+  g_pending = (uint8_t)((1u << count) - 1);
+  // Shares IRQ_PIT with the event wheel, so a tick never preempts an edge
+  // handler (and vice versa); SPI.usingInterrupt(IRQ_PIT) already covers it.
+  g_frameTimer.priority(32);
+  g_frameTimer.begin(frameIsr, 1000000.0f / CV_FRAME_HZ);
+}
+
+void cvFrameSet(uint8_t port, float volts){
+  if (port >= g_portCount) return;
+  uint8_t bit = (uint8_t)(1u << port);
+  __disable_irq();
+  if (g_pending & bit) g_coalesced++;
+  g_target[port] = volts;
+  g_pending |= bit;
+  __enable_irq();
+}
+
+// Loop-side: send one output's pending target now instead of at the next
+// tick. The SPI transaction masks IRQ_PIT, so no tick interleaves the write.
+void cvFrameFlushNow(uint8_t port){
+  if (port >= g_portCount) return;
+  uint8_t bit = (uint8_t)(1u << port);
+  __disable_irq();
+  bool pend = g_enabled && (g_pending & bit);
+  float v = g_target[port];
+  if (pend) g_pending &= (uint8_t)~bit;
+  __enable_irq();
+  if (!pend) return;
+
+  const CvPort& p = g_ports[port];
+  uint16_t code = p.toCode(p.calCh, v);
+  if (code == g_lastCode[port]) return;
+  g_lastCode[port] = code;
+  uint16_t word = frame4822(p.dacCh, code);
+  SPI.beginTransaction(kDacSpi);
+  if (p.csPin == CV_PORT_EXPANDER) {
+    expanderDacWriteLocked(p.expCsBit, word);
+  } else {
+    digitalWriteFast(p.csPin, LOW);
+    SPI.transfer16(word);
+    digitalWriteFast(p.csPin, HIGH);
+  }
+  SPI.endTransaction();
+  g_writes++;
+}
+
+void cvFrameEnable(bool on){
+  if (on == g_enabled) return;
+  __disable_irq();
+  if (on) {
+    // Something else drove the DACs meanwhile: resend every output
+    for (uint8_t i = 0; i < g_portCount; i++) g_lastCode[i] = kNoCode;
+    g_pending = (uint8_t)((1u << g_portCount) - 1);
+  }
+  g_enabled = on;
+  __enable_irq();
+}
+
+uint32_t cvFrameTicks(){ return g_ticks; }
+uint32_t cvFrameWrites(){ return g_writes; }
+uint32_t cvFrameCoalesced(){ return g_coalesced; }
+uint32_t cvFrameMaxUs(){ return profCyclesToUs(g_maxCyc); }
+void cvFrameStatsReset(){ g_ticks = 0; g_writes = 0; g_coalesced = 0; g_maxCyc = 0; }
@@ -0,0 +1,44 @@
+#pragma once
+#include <Arduino.h>
+
+// Fixed-rate CV output frame.
+// MIDI handlers only store the latest target voltage per output; a timer
+// tick (CV_FRAME_HZ) converts each output that changed since the last tick
+// once and sends every changed DAC word inside a single SPI transaction.
+// A dense bend / pressure stream therefore costs at most one conversion and
+// one DAC write per output per frame, evenly spaced, however fast it arrives.
+
+#ifndef CV_FRAME_HZ
+#define CV_FRAME_HZ 2000
+#endif
+
+static const uint8_t CV_FRAME_MAX_PORTS = 8;
+static const uint8_t CV_PORT_EXPANDER = 0xFF;   // csPin value: CS is an expander bit
+
+typedef uint16_t (*CvToCode)(uint8_t calCh, float volts);
+
+// One DAC output. csPin is a Teensy pin, or CV_PORT_EXPANDER with expCsBit.
+struct CvPort {
+  uint8_t csPin;
+  uint8_t expCsBit;
+  uint8_t dacCh;      // MCP4822 channel (0 = A, 1 = B)
+  uint8_t calCh;      // calibration channel passed to toCode
+  CvToCode toCode;
+};
+
+void cvFrameBegin(const CvPort* ports, uint8_t count);  // after wheelInit(); starts the tick
+void cvFrameSet(uint8_t port, float volts);             // latest value wins
+// Write a pending output now (loop only). Note-on calls it for the pitch
+// output so the gate, raised later in the same loop pass, never opens on the
+// previous note's pitch.
+void cvFrameFlushNow(uint8_t port);
+// Off: ticks leave the outputs alone (chord mode drives them). Turning it
+// back on rewrites every output at the next tick.
+void cvFrameEnable(bool on);
+
+// Profiling (read from loop)
+uint32_t cvFrameTicks();       // ticks that wrote at least one output
+uint32_t cvFrameWrites();      // DAC words sent
+uint32_t cvFrameCoalesced();   // updates replaced before their tick came round
+uint32_t cvFrameMaxUs();       // longest tick
+void     cvFrameStatsReset();
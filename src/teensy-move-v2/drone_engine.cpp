@@ -0,0 +1,199 @@
+#include "drone_engine.h"
+#include <utility/dspinst.h>
+
+// Envelope shape matches the old AudioEffectEnvelope settings: linear attack,
+// 50 ms decay to 0.9 sustain, linear release from wherever the level is.
+static const float kSustain   = 0.9f;
+static const float kDecayMs   = 50.0f;
+static const float kMsToSamples = AUDIO_SAMPLE_RATE_EXACT / 1000.0f;
+static const float kPhaseToUnit = 1.0f / 4294967296.0f;
+static const uint32_t kPulseWidth = 0x40000000u;  // 25 % duty, as AudioSynthWaveform
+
+static inline float msToStep(float ms, float span) {
+  float n = ms * kMsToSamples;
+  return n < 1.0f ? span : span / n;
+}
+
+// 2-sample polynomial band-limited step residual (t, dt in cycles)
+static inline float polyBlep(float t, float dt) {
+  if (t < dt) { t /= dt; return t + t - t * t - 1.0f; }
+  if (t > 1.0f - dt) { t = (t - 1.0f) / dt; return t * t + t + t + 1.0f; }
+  return 0.0f;
+}
+
+AudioDroneEngine::AudioDroneEngine() : AudioStream(0, nullptr) {
+  // Spread start phases so stacked oscillators don't open in phase
+  for (uint8_t v = 0; v < VOICES; v++) {
+    for (uint8_t k = 0; k < DRONE_MAX_OSCS; k++) {
+      voice_[v].phase[k] = (uint32_t)(v * DRONE_MAX_OSCS + k) * 0x9E3779B9u;
+      voice_[v].inc[k] = 0; voice_[v].dt[k] = 0.0f;
+    }
+  }
+  attack(350.0f);
+  release(600.0f);
+  decayStep_ = msToStep(kDecayMs, 1.0f - kSustain);
+  oscillators(2);
+}
+
+// n: oscillator count to tune for (oscillators() tunes the new count before
+// publishing it, so update() never sees an enabled oscillator without a rate)
+void AudioDroneEngine::retune(uint8_t voice, uint8_t n) {
+  Voice& v = voice_[voice];
+  // Symmetric spread across +/- detune; odd voices mirror the even ones so
+  // the chord keeps the old "A up / B down" alternation at two oscillators.
+  float sign = (voice & 1) ? -1.0f : 1.0f;
+  for (uint8_t k = 0; k < n; k++) {
+    float pos = (n > 1) ? 1.0f - 2.0f * k / (float)(n - 1) : 0.0f;
+    float hz = v.hz * powf(2.0f, sign * pos * detuneCents_ / 1200.0f);
+    float cyc = hz / AUDIO_SAMPLE_RATE_EXACT;
+    if (cyc > 0.49f) cyc = 0.49f;
+    uint32_t inc = (uint32_t)(cyc * 4294967296.0f);
+    __disable_irq();
+    v.inc[k] = inc; v.dt[k] = cyc;
+    __enable_irq();
+  }
+}
+
+void AudioDroneEngine::frequency(uint8_t voice, float hz) {
+  if (voice >= VOICES) return;
+  voice_[voice].hz = hz;
+  retune(voice, oscCount_);
+}
+
+void AudioDroneEngine::detune(float cents) {
+  detuneCents_ = cents;
+  for (uint8_t v = 0; v < VOICES; v++) retune(v, oscCount_);
+}
+
+void AudioDroneEngine::oscillators(uint8_t n) {
+  if (n < 1) n = 1; else if (n > DRONE_MAX_OSCS) n = DRONE_MAX_OSCS;
+  // Detuned oscillators add incoherently: scale by 1/sqrt(n) so loudness
+  // stays at the old two-oscillator level (0.25 * 0.5 * 0.25 per osc).
+  float g = 0.03125f * sqrtf(2.0f / n);
+  for (uint8_t v = 0; v < VOICES; v++) retune(v, n);
+  __disable_irq();
+  oscCount_ = n; oscGain_ = g;
+  __enable_irq();
+}
+
+void AudioDroneEngine::waveform(uint8_t wave) { wave_ = wave; }
+void AudioDroneEngine::attack(float ms) { attackStep_ = msToStep(ms, 1.0f); }
+void AudioDroneEngine::release(float ms) { releaseMs_ = ms; }
+void AudioDroneEngine::gain(float level) { gain_ = level; }
+
+void AudioDroneEngine::noteOn() {
+  __disable_irq();
+  for (uint8_t v = 0; v < VOICES; v++) voice_[v].state = ENV_ATTACK;
+  __enable_irq();
+}
+
+void AudioDroneEngine::noteOff() {
+  __disable_irq();
+  for (uint8_t v = 0; v < VOICES; v++) {
+    Voice& vo = voice_[v];
+    if (vo.state == ENV_IDLE) continue;
+    vo.releaseStep = msToStep(releaseMs_, vo.env > 0.0f ? vo.env : 1.0f);
+    vo.state = ENV_RELEASE;
+  }
+  __enable_irq();
+}
+
+// Advance one block. Stage changes land on block boundaries (2.9 ms), which
+// is well inside the resolution of the pot/CC-controlled times.
+float AudioDroneEngine::advanceEnvelope(Voice& v) {
+  const float n = (float)AUDIO_BLOCK_SAMPLES;
+  switch (v.state) {
+    case ENV_ATTACK:
+      v.env += attackStep_ * n;
+      if (v.env >= 1.0f) { v.env = 1.0f; v.state = ENV_DECAY; }
+      break;
+    case ENV_DECAY:
+      v.env -= decayStep_ * n;
+      if (v.env <= kSustain) { v.env = kSustain; v.state = ENV_SUSTAIN; }
+      break;
+    case ENV_RELEASE:
+      v.env -= v.releaseStep * n;
+      if (v.env <= 0.0f) { v.env = 0.0f; v.state = ENV_IDLE; }
+      break;
+    default:
+      break;
+  }
+  return v.env;
+}
+
+// One pass per voice: sum all oscillators per sample, apply the envelope
+// ramp, accumulate into the mix. W is fixed per call so the waveform switch
+// is hoisted out of the sample loop.
+template <uint8_t W>
+void AudioDroneEngine::renderVoice(Voice& v, float* mix, float e0, float de) {
+  const uint8_t n = oscCount_;
+  const float g = oscGain_;
+  uint32_t ph[DRONE_MAX_OSCS];
+  for (uint8_t k = 0; k < n; k++) ph[k] = v.phase[k];
+
+  float env = e0;
+  for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+    float s = 0.0f;
+    for (uint8_t k = 0; k < n; k++) {
+      uint32_t p = ph[k];
+      float t = p * kPhaseToUnit, dt = v.dt[k];
+      if (W == WAVEFORM_SAWTOOTH) {
+        s += 2.0f * t - 1.0f - polyBlep(t, dt);
+      } else if (W == WAVEFORM_SQUARE || W == WAVEFORM_PULSE) {
+        uint32_t pw = (W == WAVEFORM_SQUARE) ? 0x80000000u : kPulseWidth;
+        float x = (p < pw) ? 1.0f : -1.0f;
+        x += polyBlep(t, dt);
+        x -= polyBlep((uint32_t)(p - pw) * kPhaseToUnit, dt);
+        s += x;
+      } else if (W == WAVEFORM_TRIANGLE) {
+        s += 4.0f * fabsf(t - 0.5f) - 1.0f;
+      } else {
+        uint32_t idx = p >> 24, frac = (p >> 8) & 0xFFFF;
+        int32_t a = AudioWaveformSine[idx], b = AudioWaveformSine[idx + 1];
+        s += (float)(a * (int32_t)(0x10000 - frac) + b * (int32_t)frac) * (1.0f / (32767.0f * 65536.0f));
+      }
+      ph[k] = p + v.inc[k];
+    }
+    mix[i] += s * g * env;
+    env += de;
+  }
+  for (uint8_t k = 0; k < n; k++) v.phase[k] = ph[k];
+}
+
+void AudioDroneEngine::update() {
+  bool active = false;
+  for (uint8_t v = 0; v < VOICES; v++) if (voice_[v].state != ENV_IDLE) active = true;
+  if (!active) return;   // no transmit = silence downstream, zero cost at rest
+
+  audio_block_t* block = allocate();
+  if (!block) return;
+
+  float mix[AUDIO_BLOCK_SAMPLES];
+  for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) mix[i] = 0.0f;
+
+  for (uint8_t v = 0; v < VOICES; v++) {
+    Voice& vo = voice_[v];
+    if (vo.state == ENV_IDLE) continue;
+    float e0 = vo.env;
+    float e1 = advanceEnvelope(vo);
+    float de = (e1 - e0) * (1.0f / AUDIO_BLOCK_SAMPLES);
+    switch (wave_) {
+      case WAVEFORM_SAWTOOTH: renderVoice<WAVEFORM_SAWTOOTH>(vo, mix, e0, de); break;
+      case WAVEFORM_SQUARE:   renderVoice<WAVEFORM_SQUARE>(vo, mix, e0, de);   break;
+      case WAVEFORM_PULSE:    renderVoice<WAVEFORM_PULSE>(vo, mix, e0, de);    break;
+      case WAVEFORM_TRIANGLE: renderVoice<WAVEFORM_TRIANGLE>(vo, mix, e0, de); break;
+      default:                renderVoice<WAVEFORM_SINE>(vo, mix, e0, de);     break;
+    }
+  }
+
+  // Master gain, saturate and pack two samples per word (SSAT + PKHBT)
+  const float g = gain_ * 32767.0f;
+  uint32_t* out = (uint32_t*)block->data;
+  for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i += 2) {
+    int32_t a = signed_saturate_rshift((int32_t)(mix[i] * g), 16, 0);
+    int32_t b = signed_saturate_rshift((int32_t)(mix[i + 1] * g), 16, 0);
+    *out++ = pack_16b_16b(b, a);
+  }
+  transmit(block);
+  AudioStream::release(block);
+}
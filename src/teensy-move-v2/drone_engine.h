@@ -0,0 +1,62 @@
+#pragma once
+#include <Arduino.h>
+#include <Audio.h>
+
+// Chord drone rendered by a single AudioStream.
+// Replaces the 18-object graph (8x AudioSynthWaveform -> 4x AudioMixer4 ->
+// 4x AudioEffectEnvelope -> AudioMixer4 -> AudioAmplifier) with one update()
+// that renders every detuned oscillator, the per-voice envelopes and the
+// master gain into one block. No intermediate blocks are allocated.
+//
+// Oscillators are band-limited (PolyBLEP saw/square/pulse, table sine) and
+// take the Audio library's WAVEFORM_* codes so callers keep their settings.
+
+#ifndef DRONE_MAX_OSCS
+#define DRONE_MAX_OSCS 7   // oscillators per voice (compile-time ceiling)
+#endif
+
+class AudioDroneEngine : public AudioStream {
+public:
+  static const uint8_t VOICES = 4;
+
+  AudioDroneEngine();
+
+  void frequency(uint8_t voice, float hz);  // voice centre frequency
+  void detune(float cents);                 // outer oscillators sit at +/- cents
+  void oscillators(uint8_t n);              // 1..DRONE_MAX_OSCS per voice
+  uint8_t oscillators() const { return oscCount_; }
+  void waveform(uint8_t wave);              // WAVEFORM_SINE/SAWTOOTH/SQUARE/TRIANGLE/PULSE
+  void attack(float ms);
+  void release(float ms);
+  void gain(float level);                   // master level (was droneAmp)
+  void noteOn();                            // all voices
+  void noteOff();
+
+  void update() override;
+
+private:
+  enum EnvState : uint8_t { ENV_IDLE, ENV_ATTACK, ENV_DECAY, ENV_SUSTAIN, ENV_RELEASE };
+  struct Voice {
+    float    hz = 110.0f;
+    uint32_t phase[DRONE_MAX_OSCS];
+    uint32_t inc[DRONE_MAX_OSCS];
+    float    dt[DRONE_MAX_OSCS];    // inc as a fraction of a cycle (PolyBLEP width)
+    float    env = 0.0f;
+    float    releaseStep = 0.0f;
+    EnvState state = ENV_IDLE;
+  };
+
+  void  retune(uint8_t voice, uint8_t n);
+  float advanceEnvelope(Voice& v);  // steps one block, returns end level
+  template <uint8_t W> void renderVoice(Voice& v, float* mix, float e0, float de);
+
+  Voice   voice_[VOICES];
+  uint8_t oscCount_  = 2;
+  uint8_t wave_      = WAVEFORM_SAWTOOTH;
+  float   detuneCents_ = 12.0f;
+  float   oscGain_   = 0.03125f;   // per-oscillator level, RMS-normalised to oscCount_
+  float   gain_      = 1.0f;
+  float   attackStep_  = 0.0f;     // envelope increments per sample
+  float   decayStep_   = 0.0f;
+  float   releaseMs_   = 600.0f;
+};
@@ -0,0 +1,77 @@
+#include "drum_trig.h"
+#include "spi_bus.h"
+#include "event_wheel.h"
+
+// Pulse width per lane: velocity 1 -> MIN_US, velocity 127 -> MAX_US.
+// Some drum voices (e.g. variable-decay hats) read a longer trigger as an
+// accent; keep MAX_US short enough that none of them treat it as a gate.
+struct DrumLane { uint8_t bit; uint16_t minUs, maxUs; };
+static const DrumLane kLanes[DRUM_LANE_COUNT] = {
+  { ExpanderBits::DRUM1,   500, 2000 },
+  { ExpanderBits::DRUM2,   500, 2000 },
+  { ExpanderBits::DRUM3,   500, 2000 },
+  { ExpanderBits::DRUM4,   500, 2000 },
+#ifdef DRUM_LANES_ON_EXP_GATES
+  { ExpanderBits::V1_GATE, 500, 2000 },
+  { ExpanderBits::V2_GATE, 500, 2000 },
+#endif
+};
+
+static volatile uint8_t g_active = 0;   // bit per lane
+// Off edges the wheel had no room for: drumTrigPoll() releases them (loop only)
+static uint8_t  g_loopOff = 0;          // bit per lane
+static uint32_t g_loopOffUs[DRUM_LANE_COUNT];
+
+// Expander Q is pre-inverter: Q LOW = jack HIGH = trigger active
+static inline uint8_t laneMask(uint8_t lane){ return (uint8_t)(1u << kLanes[lane].bit); }
+
+// Event-wheel handler (timer ISR): off edge
+static void drumOff(uint8_t lane, uint16_t){
+  g_active &= (uint8_t)~(1u << lane);
+  expanderModify(0, laneMask(lane));                  // back to idle (Q HIGH)
+}
+
+void drumTrigInit(){
+  g_active = 0;
+  expanderModify(0, drumTrigLaneMask());
+}
+
+void drumTrigFire(uint8_t lane, uint8_t vel){
+  if (lane >= DRUM_LANE_COUNT) return;
+  if (vel > 127) vel = 127;
+  const DrumLane& L = kLanes[lane];
+  uint32_t widthUs = L.minUs + ((uint32_t)(L.maxUs - L.minUs) * (vel ? vel - 1 : 0)) / 126;
+
+  // A retrigger inside the pulse restarts the width from now
+  wheelCancel(drumOff, lane);
+  g_loopOff &= (uint8_t)~(1u << lane);
+  __disable_irq(); g_active |= (uint8_t)(1u << lane); __enable_irq();
+  expanderModify(laneMask(lane), 0);                  // on edge now (Q LOW)
+  uint32_t offUs = micros() + widthUs;
+  if (!wheelSchedule(offUs, drumOff, lane, 0)) {
+    // Wheel full: loop() owes the off edge (late by up to one loop pass)
+    g_loopOffUs[lane] = offUs;
+    g_loopOff |= (uint8_t)(1u << lane);
+  }
+}
+
+void drumTrigPoll(){
+  if (!g_loopOff) return;
+  uint32_t nowUs = micros();
+  for (uint8_t lane = 0; lane < DRUM_LANE_COUNT; lane++) {
+    if (!(g_loopOff & (1u << lane)) || (int32_t)(nowUs - g_loopOffUs[lane]) < 0) continue;
+    g_loopOff &= (uint8_t)~(1u << lane);
+    __disable_irq(); g_active &= (uint8_t)~(1u << lane); __enable_irq();
+    expanderModify(0, laneMask(lane));
+  }
+}
+
+bool drumTrigActive(uint8_t lane){
+  return lane < DRUM_LANE_COUNT && (g_active & (1u << lane));
+}
+
+uint8_t drumTrigLaneMask(){
+  uint8_t m = 0;
+  for (uint8_t i = 0; i < DRUM_LANE_COUNT; i++) m |= laneMask(i);
+  return m;
+}
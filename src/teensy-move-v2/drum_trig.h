@@ -0,0 +1,23 @@
+#pragma once
+#include <Arduino.h>
+
+// Drum trigger lanes with timer-scheduled off edges.
+// The on edge is latched immediately from the MIDI callback; the off edge is
+// queued on the event wheel (event_wheel.h), so pulse width no longer depends
+// on how long loop() takes to come round (OLED paint, USB bursts).
+//
+// Lanes 1-4 are the expander drum outputs Q2-Q5. Building with
+// -DDRUM_LANES_ON_EXP_GATES adds lanes 5-6 on the expander gate jacks
+// (Q1/Q0); CV/chord gates 3-4 then no longer drive those bits.
+
+#ifdef DRUM_LANES_ON_EXP_GATES
+static const uint8_t DRUM_LANE_COUNT = 6;
+#else
+static const uint8_t DRUM_LANE_COUNT = 4;
+#endif
+
+void drumTrigInit();                          // after expanderInit() + wheelInit()
+void drumTrigFire(uint8_t lane, uint8_t vel); // vel 1..127 scales pulse width (accent)
+void drumTrigPoll();                          // loop(): off edges the full wheel could not take
+bool drumTrigActive(uint8_t lane);
+uint8_t drumTrigLaneMask();                   // expander bits owned by the drum lanes
@@ -0,0 +1,98 @@
+#include "event_wheel.h"
+#include <SPI.h>
+
+struct WheelEvent { uint32_t atUs; WheelFn fn; uint8_t arg; uint16_t val; };
+
+// Sorted by deadline, earliest at [0]. The queue is short (a chord is 8
+// events), so insertion by shifting beats a heap and keeps FIFO order.
+static WheelEvent g_ev[WHEEL_CAPACITY];
+static volatile uint8_t g_count = 0;
+static IntervalTimer g_wheelTimer;
+
+static volatile uint8_t  g_depthMax = 0;
+static volatile uint32_t g_lateMaxUs = 0;
+static volatile uint32_t g_fullCount = 0;
+
+static void wheelIsr();
+
+// Arm the one-shot for the head event. Caller has IRQs off.
+static void armLocked(uint32_t nowUs){
+  if (!g_count) { g_wheelTimer.end(); return; }
+  int32_t d = (int32_t)(g_ev[0].atUs - nowUs);
+  if (d < 2) d = 2;
+  g_wheelTimer.begin(wheelIsr, (uint32_t)d);   // restarts the countdown
+}
+
+static void wheelIsr(){
+  for (;;) {
+    __disable_irq();
+    uint32_t nowUs = micros();
+    if (!g_count || (int32_t)(g_ev[0].atUs - nowUs) > 1) {
+      armLocked(nowUs);
+      __enable_irq();
+      return;
+    }
+    WheelEvent e = g_ev[0];
+    for (uint8_t i = 1; i < g_count; i++) g_ev[i - 1] = g_ev[i];
+    g_count--;
+    __enable_irq();
+
+    int32_t late = (int32_t)(nowUs - e.atUs);
+    if (late > 0 && (uint32_t)late > g_lateMaxUs) g_lateMaxUs = late;
+    e.fn(e.arg, e.val);   // may schedule follow-up events
+  }
+}
+
+void wheelInit(){
+  g_count = 0;
+  // Every SPI transaction in loop() masks the PIT while it holds the bus,
+  // so a handler's DAC/595 write can never interleave with loop() traffic.
+  SPI.usingInterrupt(IRQ_PIT);
+  g_wheelTimer.priority(32);
+}
+
+bool wheelSchedule(uint32_t atUs, WheelFn fn, uint8_t arg, uint16_t val){
+  __disable_irq();
+  if (g_count >= WHEEL_CAPACITY) { g_fullCount++; __enable_irq(); return false; }
+  uint32_t nowUs = micros();
+  int32_t key = (int32_t)(atUs - nowUs);
+  // Walk back from the tail past everything later than us (stable for ties)
+  uint8_t i = g_count;
+  while (i > 0 && (int32_t)(g_ev[i - 1].atUs - nowUs) > key) { g_ev[i] = g_ev[i - 1]; i--; }
+  g_ev[i].atUs = atUs; g_ev[i].fn = fn; g_ev[i].arg = arg; g_ev[i].val = val;
+  g_count++;
+  if (g_count > g_depthMax) g_depthMax = g_count;
+  if (i == 0) armLocked(nowUs);
+  __enable_irq();
+  return true;
+}
+
+uint8_t wheelCancel(WheelFn fn, uint8_t arg){
+  __disable_irq();
+  uint8_t w = 0, dropped = 0;
+  bool headGone = false;
+  for (uint8_t r = 0; r < g_count; r++) {
+    bool match = g_ev[r].fn == fn && (arg == WHEEL_ANY_ARG || g_ev[r].arg == arg);
+    if (match) { dropped++; if (r == 0) headGone = true; continue; }
+    g_ev[w++] = g_ev[r];
+  }
+  g_count = w;
+  if (headGone) armLocked(micros());
+  __enable_irq();
+  return dropped;
+}
+
+bool wheelPendingAt(WheelFn fn, uint8_t arg, uint32_t* atUs){
+  bool found = false;
+  __disable_irq();
+  for (uint8_t i = 0; i < g_count; i++) {
+    if (g_ev[i].fn == fn && (arg == WHEEL_ANY_ARG || g_ev[i].arg == arg)) { *atUs = g_ev[i].atUs; found = true; break; }
+  }
+  __enable_irq();
+  return found;
+}
+
+uint8_t  wheelDepthMax(){ return g_depthMax; }
+uint32_t wheelLateMaxUs(){ return g_lateMaxUs; }
+uint32_t wheelFullCount(){ return g_fullCount; }
+void wheelStatsReset(){ g_depthMax = g_count; g_lateMaxUs = 0; g_fullCount = 0; }
@@ -0,0 +1,34 @@
+#pragma once
+#include <Arduino.h>
+
+// Sorted output-event queue serviced by a one-shot IntervalTimer.
+// Gate edges and DAC writes that must land at an exact time (drum off edges,
+// strummed chord onsets, arpeggiator steps) are queued with a micros()
+// deadline and run from the timer ISR, so loop() stalls (OLED flush, USB
+// bursts) no longer move them.
+//
+// Handlers run in interrupt context: keep them short, and only touch the SPI
+// bus through transactions (SPI.usingInterrupt(IRQ_PIT) is registered by
+// wheelInit(), so loop()'s transactions hold the timer off).
+
+#ifndef WHEEL_CAPACITY
+#define WHEEL_CAPACITY 48
+#endif
+
+typedef void (*WheelFn)(uint8_t arg, uint16_t val);
+static const uint8_t WHEEL_ANY_ARG = 0xFF;
+
+void wheelInit();                                    // after SPI.begin()
+// Queue fn(arg, val) at atUs (micros() clock). Events with equal deadlines
+// run in the order they were queued. Returns false if the wheel is full.
+bool wheelSchedule(uint32_t atUs, WheelFn fn, uint8_t arg, uint16_t val);
+// Drop pending events for fn (and arg, unless WHEEL_ANY_ARG); returns count
+uint8_t wheelCancel(WheelFn fn, uint8_t arg = WHEEL_ANY_ARG);
+// Deadline of the first pending fn/arg event, false if none
+bool wheelPendingAt(WheelFn fn, uint8_t arg, uint32_t* atUs);
+
+// Profiling (read from loop)
+uint8_t  wheelDepthMax();                            // deepest queue since reset
+uint32_t wheelLateMaxUs();                           // worst deadline -> handler start
+uint32_t wheelFullCount();                           // events dropped (queue full)
+void     wheelStatsReset();
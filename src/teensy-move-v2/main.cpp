@@ -1,7 +1,7 @@
 // Teensy Move V2 — Optimized for rock-solid MIDI timing
 // Changes from V1:
-// - Reduced OLED refresh rate (150ms vs 80ms)
-// - Partial OLED updates (only changed rows)
+// - Non-blocking OLED: changed rows redrawn one per pass, changed pages
+//   flushed over interrupt-driven I2C (oled_pager)
 // - Loop timing diagnostics available
 // - Two modes: MIDI-to-CV and Chord mode
 // - Drums (ch10) work in both modes
@@ -14,7 +14,14 @@
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
 #include <Audio.h>
+#include "oled_pager/OledPager.h"
 #include "spi_bus.h"
+#include "drum_trig.h"
+#include "event_wheel.h"
+#include "cv_frame.h"
+#include "drone_engine.h"
+#include "audio_follower.h"
+#include "profile.h"
 #include "teensy-move-v2/pins.h"
 #include "teensy-move-v2/calib_static.h"
 #include "teensy-move-v2/chord_library.h"
@@ -22,6 +29,7 @@
 #define OLED_W 128
 #define OLED_H 32
 Adafruit_SSD1306 oled(OLED_W, OLED_H, &Wire, -1);
+static oled_pager::OledPager oledPager(oled);
 
 // ============================================================================
 // AUDIO OBJECTS — Line passthrough + Chord Drone
@@ -33,14 +41,21 @@ AudioOutputUSB          usbOut;
 #endif
 AudioControlSGTL5000    sgtl5000;
 
+#ifdef DRONE_LEGACY_GRAPH
 // Chord drone: 2 oscillators per voice (4 voices = 8 oscillators total) for thick detuned sound
 // Architecture: (OscA + OscB detuned) -> VoiceMix -> Envelope -> MainMix -> Output
+// Kept behind -DDRONE_LEGACY_GRAPH for CPU comparison against AudioDroneEngine.
 AudioSynthWaveform       droneOscA[4];       // Primary oscillators
 AudioSynthWaveform       droneOscB[4];       // Detuned oscillators
 AudioMixer4              droneVoiceMix[4];   // Mix 2 oscs per voice
 AudioEffectEnvelope      droneEnv[4];
 AudioMixer4              droneMix;           // Combines 4 voices
 AudioAmplifier           droneAmp;           // Master volume control
+#else
+// Chord drone: one AudioStream renders 4 voices x N detuned band-limited
+// oscillators, envelopes and master gain in a single update() (drone_engine.cpp)
+AudioDroneEngine         droneEngine;
+#endif
 AudioMixer4              outputMixL;         // Combines passthrough + drone
 AudioMixer4              outputMixR;
 
@@ -48,6 +63,7 @@ AudioMixer4              outputMixR;
 AudioConnection         pcPassL(i2sIn, 0, outputMixL, 0);   // Line in L -> output mixer ch0
 AudioConnection         pcPassR(i2sIn, 1, outputMixR, 0);   // Line in R -> output mixer ch0
 
+#ifdef DRONE_LEGACY_GRAPH
 // Audio connections — Drone voice 0: OscA + OscB -> Mix -> Env
 AudioConnection         pcV0OscA(droneOscA[0], 0, droneVoiceMix[0], 0);
 AudioConnection         pcV0OscB(droneOscB[0], 0, droneVoiceMix[0], 1);
@@ -73,6 +89,22 @@ AudioConnection         pcDroneMix3(droneEnv[3], 0, droneMix, 3);
 AudioConnection         pcDroneToAmp(droneMix, 0, droneAmp, 0);
 AudioConnection         pcDroneToOutL(droneAmp, 0, outputMixL, 1);
 AudioConnection         pcDroneToOutR(droneAmp, 0, outputMixR, 1);
+#else
+AudioConnection         pcDroneToOutL(droneEngine, 0, outputMixL, 1);
+AudioConnection         pcDroneToOutR(droneEngine, 0, outputMixR, 1);
+#endif
+
+// Audio -> CV follower (Follow mode drives channel 3-4 outputs). Listens to
+// the host's USB audio when the build has it, otherwise to codec line-in.
+AudioFollower            follower;
+#ifdef USB_MIDI_AUDIO_SERIAL
+AudioInputUSB            usbIn;
+AudioConnection         pcFollowL(usbIn, 0, follower, 0);
+AudioConnection         pcFollowR(usbIn, 1, follower, 1);
+#else
+AudioConnection         pcFollowL(i2sIn, 0, follower, 0);
+AudioConnection         pcFollowR(i2sIn, 1, follower, 1);
+#endif
 
 // Audio connections — Output
 AudioConnection         pcOutL(outputMixL, 0, i2sOut, 0);
@@ -93,8 +125,7 @@ AudioConnection         pcUsbR(outputMixR, 0, usbOut, 1);
 #define GATE_WRITE(pin, s) digitalWrite((pin), (s)?LOW:HIGH)   // HCT14 invert
 
 static const uint8_t DRUM_BASE_NOTE = 36;
-static const uint8_t DRUM_COUNT = 4;
-static const uint32_t DRUM_TRIG_US[DRUM_COUNT] = { 500, 500, 500, 500 };
+static const uint8_t DRUM_COUNT = DRUM_LANE_COUNT;  // pulse widths/accent live in drum_trig.cpp
 
 // Chord mode constants
 static const uint8_t CHORD_MIDI_CH = 6;  // MIDI channel for chord input
@@ -108,33 +139,38 @@ static const uint8_t CHORD_VOICE_COUNT = 4;
 void onNoteOn(byte ch, byte note, byte vel);
 void onNoteOff(byte ch, byte note, byte vel);
 void onPitchBend(byte ch, int value);
+void onAfterTouch(byte ch, byte pressure);
 void onControlChange(byte ch, byte cc, byte val);
 void onStart();
 void onStop();
 void onClock();
 
 // MCP4822
+// V2: loop-side DAC writes (SPI + expander CS traffic) are timed into profDac.
+// The *_raw variants are untimed, for the event-wheel handlers: ProfStat is
+// loop()-only (see profile.h).
+static ProfStat profDac;
 enum { CH_A=0, CH_B=1 };
-static inline uint16_t frame4822(uint8_t ch, uint16_t v){ return (ch?0x8000:0)|0x1000|(v & 0x0FFF); }
-static inline void mcp4822_write(uint8_t cs, uint8_t ch, uint16_t v){
+static inline void mcp4822_write_raw(uint8_t cs, uint8_t ch, uint16_t v){
   SPI.beginTransaction(SPISettings(4000000, MSBFIRST, SPI_MODE0));
   digitalWrite(cs, LOW);
   SPI.transfer16(frame4822(ch, v));
   digitalWrite(cs, HIGH);
   SPI.endTransaction();
 }
+static inline void mcp4822_write(uint8_t cs, uint8_t ch, uint16_t v){
+  ProfScope prof(profDac);
+  mcp4822_write_raw(cs, ch, v);
+}
 
-// Expander DACs via Q6/Q7 CS
-static inline void mcp4822_write_expander(uint8_t whichDac /*0->Q6,1->Q7*/, uint8_t ch, uint16_t v){
-  uint8_t img = expanderImage();
-  img |= (1u<<ExpanderBits::DAC1_CS) | (1u<<ExpanderBits::DAC2_CS);
-  if (whichDac == 0) img &= ~(1u<<ExpanderBits::DAC1_CS); else img &= ~(1u<<ExpanderBits::DAC2_CS);
-  expanderWrite(img);
-  SPI.beginTransaction(SPISettings(4000000, MSBFIRST, SPI_MODE0));
-  SPI.transfer16(frame4822(ch, v));
-  SPI.endTransaction();
-  img |= (1u<<ExpanderBits::DAC1_CS) | (1u<<ExpanderBits::DAC2_CS);
-  expanderWrite(img);
+// Expander DACs via Q6/Q7 CS (one SPI transaction, so an event-wheel ISR
+// can't shift the 595 while a DAC CS is asserted)
+static inline void mcp4822_write_expander_raw(uint8_t whichDac /*0->Q6,1->Q7*/, uint8_t ch, uint16_t v){
+  expanderDacWrite(whichDac ? ExpanderBits::DAC2_CS : ExpanderBits::DAC1_CS, frame4822(ch, v));
+}
+static inline void mcp4822_write_expander(uint8_t whichDac, uint8_t ch, uint16_t v){
+  ProfScope prof(profDac);
+  mcp4822_write_expander_raw(whichDac, ch, v);
 }
 
 // Calibration
@@ -167,21 +203,49 @@ static inline uint16_t modVolt_to_code_ch(uint8_t ch, float vOut){
 struct Voice { int8_t note=-1; float bend=0, modV=0, pitchHeldV=0, calib=0; };
 static Voice v1, v2, v3, v4;
 static inline float midiNote_to_volts(int note){ return (note-36)/12.0f; }
-static inline void updatePitch(Voice& v){ float base=midiNote_to_volts(v.note<0?36:v.note); v.pitchHeldV = base + v.bend/12.0f + v.calib; }
+static float mpeMasterBend = 0;  // semitones; MPE zone-wide bend from the master channel
+static inline void updatePitch(Voice& v){ float base=midiNote_to_volts(v.note<0?36:v.note); v.pitchHeldV = base + (v.bend + mpeMasterBend)/12.0f + v.calib; }
 
-// Dirty flags
-static volatile bool dirtyPitch1=true, dirtyPitch2=true, dirtyMod1=true, dirtyMod2=true;
-static volatile bool dirtyPitch3=true, dirtyPitch4=true, dirtyMod3=true, dirtyMod4=true;
+// CV outputs go through the fixed-rate frame (cv_frame.cpp); ports are
+// ordered like the diag table: M1,P1,M2,P2,M3,P3,M4,P4
+static const CvPort kCvPorts[8] = {
+  { PIN_CS_DAC1,      0,                      CH_A,              0, modVolt_to_code_ch   },
+  { PIN_CS_DAC1,      0,                      CH_B,              0, pitchVolt_to_code_ch },
+  { PIN_CS_DAC2,      0,                      CH_A,              1, modVolt_to_code_ch   },
+  { PIN_CS_DAC2,      0,                      CH_B,              1, pitchVolt_to_code_ch },
+  { CV_PORT_EXPANDER, ExpanderBits::DAC1_CS,  EXP_MOD3_CH_IDX,   2, modVolt_to_code_ch   },
+  { CV_PORT_EXPANDER, ExpanderBits::DAC2_CS,  EXP_PITCH3_CH_IDX, 2, pitchVolt_to_code_ch },
+  { CV_PORT_EXPANDER, ExpanderBits::DAC1_CS,  EXP_MOD4_CH_IDX,   3, modVolt_to_code_ch   },
+  { CV_PORT_EXPANDER, ExpanderBits::DAC2_CS,  EXP_PITCH4_CH_IDX, 3, pitchVolt_to_code_ch },
+};
+static Voice* const kCvVoices[4] = { &v1, &v2, &v3, &v4 };
+static inline void cvPushPitch(uint8_t i){ cvFrameSet(2*i+1, kCvVoices[i]->pitchHeldV); }
+static inline void cvPushMod(uint8_t i){ cvFrameSet(2*i, kCvVoices[i]->modV); }
 
 // Realtime outputs
 static volatile bool gate1=false, gate2=false, clk=false, rst=false;
 static volatile bool gate3=false, gate4=false;
-static volatile uint32_t clkUntil=0, rstUntil=0; const uint32_t PULSE_MS=5;
+static volatile bool* const kCvGates[4] = { &gate1, &gate2, &gate3, &gate4 };
 
-// Drums
-static volatile bool drumTrig[DRUM_COUNT] = {false,false,false,false};
-static volatile uint32_t drumUntilUs[DRUM_COUNT] = {0,0,0,0};
-static volatile bool drumDirty = false;
+// MPE (lower zone): an MCM (RPN 6 on ch 1) turns member channels 2..5 into
+// voices 1-4, ch 1 bend moves all of them. Without it ch 1-4 map to voices
+// 1-4 as before. RPN 0 sets the bend range per channel.
+static const uint8_t MPE_MASTER_CH = 1;
+static uint8_t mpeMembers = 0;                 // 0 = MPE off
+static uint8_t bendRangeSemis[17];             // by MIDI channel (1-16)
+static uint8_t rpnMsb[17], rpnLsb[17];
+static bool followOn = false;                  // Follow mode owns voices 3-4
+static int8_t cvVoiceForChannel(uint8_t ch){
+  int8_t vi;
+  if (mpeMembers) {
+    uint8_t last = 1 + (mpeMembers < 4 ? mpeMembers : 4);
+    vi = (ch >= 2 && ch <= last) ? (int8_t)(ch - 2) : -1;
+  } else {
+    vi = (ch >= 1 && ch <= 4) ? (int8_t)(ch - 1) : -1;
+  }
+  return (followOn && vi >= 2) ? -1 : vi;
+}
+static volatile uint32_t clkUntil=0, rstUntil=0; const uint32_t PULSE_MS=5;
 
 // Debug
 static volatile uint8_t lastMidiCh=0, lastMidiNote=0, lastMidiVel=0; static volatile uint32_t lastMidiMs=0;
@@ -190,12 +254,16 @@ static volatile uint8_t lastMidiCh=0, lastMidiNote=0, lastMidiVel=0; static vola
 static uint32_t btnDownAt=0; static bool btnPrev=HIGH; const uint16_t LONG_MS=600; static uint32_t lastBeat=0;
 static uint32_t btnLastChange=0; const uint16_t DEBOUNCE_MS=30;  // Debounce window
 static uint32_t lastOledPaintMs=0;
-static const uint32_t OLED_FPS_MS=150;  // V2: Slower refresh (was 80ms) — reduces blocking
+static const uint32_t OLED_FPS_MS=80;  // row rebuild rate; drawing and flush are spread over passes
 static inline void drawRow(uint8_t row,const char* s){ oled.setCursor(0,row*8); oled.print(s); }
 static char lineBuf[64];
-static uint8_t gOledPage = 0; // 0 = CH1-2, 1 = CH3-4, 2 = CHORD, 3 = DRONE
+static uint8_t gOledPage = 0; // 0 = CH1-2, 1 = CH3-4, 2 = CHORD, 3 = DRONE, 4 = PROF
+static uint8_t gModePage = 0; // Last non-PROF page — selects CV (0-1) vs chord (2-3) behaviour
+static const uint8_t OLED_PAGE_COUNT = 5;
+static const uint8_t PAGE_PROF = 4;
 
-// V2: OLED row cache for partial updates
+// V2: OLED row cache for partial updates. Row r is SSD1306 page r on the
+// 128x32 panel, so redrawing one row dirties exactly one page for the pager.
 static char oledRowCache[4][22] = {"","","",""};  // 21 chars max per row + null
 static bool oledRowDirty[4] = {true, true, true, true};
 
@@ -206,6 +274,20 @@ static uint32_t loopCount = 0;
 static const uint32_t LOOP_STATS_INTERVAL_MS = 5000;
 static uint32_t lastLoopStatsMs = 0;
 
+// V2: Profiling window (reset every LOOP_STATS_INTERVAL_MS). The PROF page
+// shows the last completed window; the serial report prints it when a
+// terminal is open.
+static LoopHistogram loopHist;
+static ProfStat profOled;            // OLED row draw + page kick (the flush itself is IRQ-driven)
+static ProfStat profMidi;            // usbMIDI drain incl. callbacks
+static uint16_t midiDrainMax = 0;    // most messages pending in one loop pass
+static uint32_t midiMsgCount = 0;
+struct ProfWindow {
+  uint32_t loopAvgUs, loopMaxUs, oledMaxUs, oledAvgUs, dacMaxUs, dacCount, midiMaxUs;
+  uint16_t midiDrainMax;
+};
+static ProfWindow profShown = {0,0,0,0,0,0,0,0};
+
 // ============================================================================
 // CHORD MODE STATE
 // ============================================================================
@@ -241,6 +323,11 @@ static float droneDetuneCents = 12.0f;      // Detune amount in cents (wider = t
 static uint8_t droneWaveform = WAVEFORM_SAWTOOTH;  // Current waveform
 static float droneAttackMs = 350.0f;        // Attack time in ms
 static float droneReleaseMs = 600.0f;       // Release time in ms
+#ifdef DRONE_LEGACY_GRAPH
+static uint8_t droneOscCount = 2;           // Fixed: OscA + OscB per voice
+#else
+static uint8_t droneOscCount = 3;           // Oscillators per voice (1..DRONE_MAX_OSCS)
+#endif
 
 // Waveform names for display
 static const char* waveformNames[] = {"SAW", "SQR", "TRI", "SIN", "PUL"};
@@ -264,6 +351,7 @@ static inline float semitoneToFreq(int8_t semitone, uint8_t rootNote, uint8_t ba
 
 // Initialize drone audio objects
 static void initDrone() {
+#ifdef DRONE_LEGACY_GRAPH
     // Set up dual oscillators per voice for thick detuned sound
     for (int i = 0; i < 4; i++) {
         // Primary oscillator
@@ -294,6 +382,14 @@ static void initDrone() {
     
     // Master volume amplifier
     droneAmp.gain(droneLevel);
+#else
+    droneEngine.waveform(droneWaveform);
+    droneEngine.oscillators(droneOscCount);
+    droneEngine.detune(droneDetuneCents);
+    droneEngine.attack(droneAttackMs);
+    droneEngine.release(droneReleaseMs);
+    droneEngine.gain(droneLevel);
+#endif
     
     // Output mixer: passthrough full, drone controlled by amp
     outputMixL.gain(0, 1.0f);   // Passthrough
@@ -304,17 +400,23 @@ static void initDrone() {
 
 // Set drone oscillator frequencies from chord pitches (with detuning)
 static void updateDroneFrequencies(int8_t* intervals, uint8_t rootNote, uint8_t baseOctave) {
+#ifdef DRONE_LEGACY_GRAPH
     float detuneRatio = getDetuneRatio(droneDetuneCents);
+#endif
     for (int i = 0; i < 4; i++) {
         float baseFreq = semitoneToFreq(intervals[i], rootNote, baseOctave);
         droneFreqs[i] = baseFreq;
         
+#ifdef DRONE_LEGACY_GRAPH
         // Alternate detune direction: voice 0,2 detune up; voice 1,3 detune down
         float detuneA = (i % 2 == 0) ? detuneRatio : (1.0f / detuneRatio);
         float detuneB = (i % 2 == 0) ? (1.0f / detuneRatio) : detuneRatio;
         
         droneOscA[i].frequency(baseFreq * detuneA);
         droneOscB[i].frequency(baseFreq * detuneB);
+#else
+        droneEngine.frequency(i, baseFreq);  // detune spread applied per oscillator
+#endif
     }
 }
 
@@ -322,18 +424,26 @@ static void updateDroneFrequencies(int8_t* intervals, uint8_t rootNote, uint8_t
 static void triggerDrone() {
     if (!droneEnabled) return;
     
+#ifdef DRONE_LEGACY_GRAPH
     for (int i = 0; i < 4; i++) {
         droneOscA[i].amplitude(0.25f);
         droneOscB[i].amplitude(0.25f);
         droneEnv[i].noteOn();
     }
+#else
+    droneEngine.noteOn();
+#endif
 }
 
 // Release drone voices
 static void releaseDrone() {
+#ifdef DRONE_LEGACY_GRAPH
     for (int i = 0; i < 4; i++) {
         droneEnv[i].noteOff();
     }
+#else
+    droneEngine.noteOff();
+#endif
 }
 
 // Toggle drone on/off
@@ -354,32 +464,84 @@ static void toggleDrone() {
 static void updateDroneWaveform(uint8_t waveIdx) {
     if (waveIdx >= NUM_WAVEFORMS) waveIdx = 0;
     droneWaveform = waveformTypes[waveIdx];
+#ifdef DRONE_LEGACY_GRAPH
     for (int i = 0; i < 4; i++) {
         droneOscA[i].begin(droneWaveform);
         droneOscB[i].begin(droneWaveform);
     }
+#else
+    droneEngine.waveform(droneWaveform);
+#endif
 }
 
 // Update drone attack time (all envelopes)
 static void updateDroneAttack(float attackMs) {
     droneAttackMs = attackMs;
+#ifdef DRONE_LEGACY_GRAPH
     for (int i = 0; i < 4; i++) {
         droneEnv[i].attack(droneAttackMs);
     }
+#else
+    droneEngine.attack(droneAttackMs);
+#endif
 }
 
 // Update drone release time (all envelopes)
 static void updateDroneRelease(float releaseMs) {
     droneReleaseMs = releaseMs;
+#ifdef DRONE_LEGACY_GRAPH
     for (int i = 0; i < 4; i++) {
         droneEnv[i].release(droneReleaseMs);
     }
+#else
+    droneEngine.release(droneReleaseMs);
+#endif
 }
 
 // Update drone master volume
 static void updateDroneVolume(float vol) {
     droneLevel = vol;
+#ifdef DRONE_LEGACY_GRAPH
     droneAmp.gain(droneLevel);
+#else
+    droneEngine.gain(droneLevel);
+#endif
+}
+
+// Update detune spread (legacy graph picks it up on the next chord)
+static void updateDroneDetune(float cents) {
+    droneDetuneCents = cents;
+#ifndef DRONE_LEGACY_GRAPH
+    droneEngine.detune(droneDetuneCents);
+#endif
+}
+
+// Update oscillators per voice (legacy graph is fixed at 2)
+static void updateDroneOscCount(uint8_t n) {
+#ifndef DRONE_LEGACY_GRAPH
+    droneEngine.oscillators(n);
+    droneOscCount = droneEngine.oscillators();
+#else
+    (void)n;
+#endif
+}
+
+// Audio CPU (% of one update period) spent on the drone — same readout for
+// both builds so the legacy graph and the engine can be compared directly
+static inline float audioObjUsage(AudioStream& o, bool peak) {
+    return peak ? o.processorUsageMax() : o.processorUsage();
+}
+static float droneCpuUsage(bool peak = false) {
+#ifdef DRONE_LEGACY_GRAPH
+    float u = audioObjUsage(droneMix, peak) + audioObjUsage(droneAmp, peak);
+    for (int i = 0; i < 4; i++) {
+        u += audioObjUsage(droneOscA[i], peak) + audioObjUsage(droneOscB[i], peak);
+        u += audioObjUsage(droneVoiceMix[i], peak) + audioObjUsage(droneEnv[i], peak);
+    }
+    return u;
+#else
+    return audioObjUsage(droneEngine, peak);
+#endif
 }
 
 // ============================================================================
@@ -526,6 +688,209 @@ static void updateChordParams() {
     }
 }
 
+// ============================================================================
+// CHORD STRUM / ARPEGGIATOR — chord pitch + gate edges run from the event wheel
+// ============================================================================
+// Strum: voice onsets staggered by strumStepUs, low-to-high (Up), high-to-low
+// (Dn) or alternating per chord. Zero spacing gives the old block chord.
+// Arp: chord tones stepped on output 1 (Pitch1/Gate1) every kArpDivTicks MIDI
+// clocks. The step timer free-runs on the estimated tick period (120 BPM with
+// no clock) and each step-boundary clock pulls it back into phase, so steps
+// stay on the grid even when a clock byte is read late.
+enum StrumDir : uint8_t { STRUM_UP, STRUM_DOWN, STRUM_ALT, STRUM_DIR_COUNT };
+enum ArpMode : uint8_t { ARP_OFF, ARP_UP, ARP_DOWN, ARP_UPDOWN, ARP_MODE_COUNT };
+static const char* kArpModeNames[ARP_MODE_COUNT] = {"Off", "Up", "Dn", "UpDn"};
+static const uint8_t kArpDivTicks[] = {24, 12, 8, 6, 4, 3};   // 1/4 1/8 1/8T 1/16 1/16T 1/32
+static const uint8_t ARP_DIV_COUNT = sizeof(kArpDivTicks);
+
+static uint32_t strumStepUs = 0;               // CC 20: onset spacing (0-25 ms)
+static StrumDir strumDir = STRUM_UP;           // CC 21
+static bool strumFlip = false;                 // STRUM_ALT: next chord goes down
+static volatile ArpMode arpMode = ARP_OFF;     // CC 22
+static volatile uint8_t arpDiv = 3;            // CC 23: kArpDivTicks index (1/16)
+static volatile uint8_t arpGatePct = 50;       // CC 24: gate length, % of step (10-90)
+
+static uint16_t chordCode[4];                  // pitch DAC codes of the held chord, per output
+static uint8_t chordOrder[4] = {0, 1, 2, 3};   // outputs sorted low -> high pitch
+static volatile uint16_t arpCode[4];           // chord tones low -> high, output 1 calibration
+static volatile bool arpRunning = false;
+static volatile uint8_t arpStep = 0;
+static volatile uint32_t arpNextUs = 0;        // deadline of the queued step
+static volatile uint32_t arpLastUs = 0;        // deadline of the step last played
+
+// 24-PPQN lock: tick period + phase, filtered against USB / loop() jitter
+static volatile uint32_t clkPeriodUs = 20833;  // 120 BPM until a clock arrives
+static volatile uint32_t clkPhaseUs = 0;       // filtered time of the last tick
+static uint32_t clkLastRawUs = 0;
+static volatile bool clkHalted = false;        // MIDI Stop: arp waits for the next clock
+
+// Chord outputs: only called from event-wheel handlers (or with IRQs off)
+static void writeChordGate(uint8_t v, bool on) {
+  chordGate[v] = on;
+  switch (v) {
+    case 0: GATE_WRITE(PIN_GATE1, on); break;
+    case 1: GATE_WRITE(PIN_GATE2, on); break;
+#ifndef DRUM_LANES_ON_EXP_GATES
+    case 2: if (on) expanderModify(1u<<ExpanderBits::V1_GATE, 0); else expanderModify(0, 1u<<ExpanderBits::V1_GATE); break;
+    case 3: if (on) expanderModify(1u<<ExpanderBits::V2_GATE, 0); else expanderModify(0, 1u<<ExpanderBits::V2_GATE); break;
+#endif
+  }
+}
+static void writeChordPitch(uint8_t v, uint16_t code) {
+  switch (v) {
+    case 0: mcp4822_write_raw(PIN_CS_DAC1, CH_B, code); break;
+    case 1: mcp4822_write_raw(PIN_CS_DAC2, CH_B, code); break;
+    case 2: mcp4822_write_expander_raw(1, EXP_PITCH3_CH_IDX, code); break;
+    case 3: mcp4822_write_expander_raw(1, EXP_PITCH4_CH_IDX, code); break;
+  }
+}
+
+// Event-wheel handlers (timer ISR)
+static void evChordPitch(uint8_t v, uint16_t code) { writeChordPitch(v, code); }
+static void evChordGate(uint8_t v, uint16_t on) { writeChordGate(v, on != 0); }
+
+// Gate-offs the wheel had no room for: written now if already due, else owed
+// by chordGatePoll() from loop() (late by up to one loop pass)
+static volatile uint8_t chordOffOwed = 0;      // bit per output
+static volatile uint32_t chordOffUs[4];
+
+static void chordGateOffAt(uint8_t v, uint32_t t) {
+  if (wheelSchedule(t, evChordGate, v, 0)) return;
+  __disable_irq();
+  if ((int32_t)(t - micros()) <= 0) {
+    chordOffOwed &= (uint8_t)~(1u << v);
+    writeChordGate(v, false);
+  } else {
+    chordOffUs[v] = t;
+    chordOffOwed |= (uint8_t)(1u << v);
+  }
+  __enable_irq();
+}
+
+static void chordGatePoll() {
+  if (!chordOffOwed) return;
+  __disable_irq();
+  uint32_t nowUs = micros();
+  for (uint8_t v = 0; v < 4; v++) {
+    if ((chordOffOwed & (1u << v)) && (int32_t)(nowUs - chordOffUs[v]) >= 0) {
+      chordOffOwed &= (uint8_t)~(1u << v);
+      writeChordGate(v, false);
+    }
+  }
+  __enable_irq();
+}
+static void evArpStep(uint8_t, uint16_t) {
+  if (!arpRunning || clkHalted) return;
+  uint8_t div = kArpDivTicks[arpDiv];
+  uint32_t stepUs = clkPeriodUs * div;
+  uint8_t idx;
+  switch (arpMode) {
+    case ARP_DOWN:   idx = 3 - (arpStep & 3); break;
+    case ARP_UPDOWN: { uint8_t p = arpStep % 6; idx = p < 4 ? p : 6 - p; } break;
+    default:         idx = arpStep & 3; break;
+  }
+  arpStep = (arpStep + 1) % 12;
+  uint32_t t = arpNextUs;
+  arpLastUs = t;
+  writeChordPitch(0, arpCode[idx]);
+  chordOffOwed &= (uint8_t)~1u;
+  writeChordGate(0, true);
+  chordGateOffAt(0, t + stepUs / 100 * arpGatePct);
+  arpNextUs = t + stepUs;
+  wheelSchedule(arpNextUs, evArpStep, 0, 0);
+}
+
+// Stop everything the wheel still has queued for the chord outputs
+static void chordEventsCancel() {
+  wheelCancel(evArpStep); wheelCancel(evChordGate); wheelCancel(evChordPitch);
+  chordOffOwed = 0;
+}
+
+// Mode switch into CHORD/DRONE: outputs follow chordGate again
+static void chordGatesResync() {
+  __disable_irq();
+  for (uint8_t v = 0; v < 4; v++) writeChordGate(v, chordGate[v]);
+  __enable_irq();
+}
+
+// Queue the held chord: strum or arp start. Called from triggerChord().
+static void chordScheduleOn() {
+  // Sort outputs by pitch for strum direction / arp order
+  for (uint8_t i = 0; i < 4; i++) chordOrder[i] = i;
+  for (uint8_t i = 1; i < 4; i++)
+    for (uint8_t j = i; j > 0 && chordCode[chordOrder[j]] < chordCode[chordOrder[j-1]]; j--) {
+      uint8_t t = chordOrder[j]; chordOrder[j] = chordOrder[j-1]; chordOrder[j-1] = t;
+    }
+
+  chordEventsCancel();
+  uint32_t t0 = micros();
+  if (arpMode != ARP_OFF) {
+    for (uint8_t i = 0; i < 4; i++) arpCode[i] = pitchVolt_to_code_ch(0, chordPitchV[chordOrder[i]]);
+    for (uint8_t v = 1; v < 4; v++) chordGateOffAt(v, t0);
+    arpStep = 0; arpRunning = true; arpNextUs = t0;
+    wheelSchedule(t0, evArpStep, 0, 0);
+    return;
+  }
+  arpRunning = false;
+  bool down = (strumDir == STRUM_DOWN) || (strumDir == STRUM_ALT && strumFlip);
+  if (strumDir == STRUM_ALT) strumFlip = !strumFlip;
+  for (uint8_t k = 0; k < 4; k++) {
+    uint8_t v = chordOrder[down ? 3 - k : k];
+    uint32_t t = t0 + k * strumStepUs;
+    if (wheelSchedule(t, evChordPitch, v, chordCode[v]) &&  // pitch settles before the gate
+        wheelSchedule(t, evChordGate, v, 1)) continue;
+    // Wheel full: this voice sounds now, unstrummed
+    wheelCancel(evChordPitch, v);
+    __disable_irq(); writeChordPitch(v, chordCode[v]); writeChordGate(v, true); __enable_irq();
+  }
+}
+
+static void chordScheduleOff() {
+  arpRunning = false;
+  chordEventsCancel();
+  uint32_t t0 = micros();
+  for (uint8_t v = 0; v < 4; v++) chordGateOffAt(v, t0);
+}
+
+// Called from onClock() with the post-increment tick count
+static void arpClockTick(uint32_t tick) {
+  uint32_t t = micros();
+  if (clkLastRawUs) {
+    uint32_t d = t - clkLastRawUs;
+    if (d > 2000 && d < 100000) {               // 25-1250 BPM; else re-seed
+      clkPeriodUs = (uint32_t)((int32_t)clkPeriodUs + ((int32_t)d - (int32_t)clkPeriodUs) / 8);
+      // Late reads only ever push t later, so follow them slowly
+      uint32_t pred = clkPhaseUs + clkPeriodUs;
+      clkPhaseUs = pred + (int32_t)(t - pred) / 4;
+    } else {
+      clkPhaseUs = t;
+    }
+  } else {
+    clkPhaseUs = t;
+  }
+  clkLastRawUs = t;
+  bool resume = clkHalted;
+  clkHalted = false;
+
+  if (!arpRunning) return;
+  uint8_t div = kArpDivTicks[arpDiv];
+  if (tick % div) return;
+  // Step boundary: re-queue the step timer on the filtered tick phase. If the
+  // step for this boundary already played, the next one is a step away.
+  uint32_t stepUs = clkPeriodUs * div;
+  wheelCancel(evArpStep);
+  uint32_t target = clkPhaseUs;
+  if (!resume && (int32_t)(target - arpLastUs) < (int32_t)(stepUs / 2)) target += stepUs;
+  arpNextUs = target;
+  wheelSchedule(target, evArpStep, 0, 0);
+}
+
+static void arpClockStop() {
+  clkHalted = true; clkLastRawUs = 0;
+  wheelCancel(evArpStep);
+  if (arpRunning) chordGateOffAt(0, micros());
+}
+
 // Trigger a chord from a MIDI note
 static void triggerChord(uint8_t midiNote) {
     chordHeldNote = midiNote;
@@ -551,34 +916,31 @@ static void triggerChord(uint8_t midiNote) {
     // Determine base octave from the played note
     uint8_t baseOctave = midiNote / 12;
     
-    // Convert to voltages
+    // Convert to voltages; the event wheel writes pitch + gate per voice
     for (int i = 0; i < 4; i++) {
         chordPitchV[i] = semitoneToVolt(intervals[i], chordRootNote, baseOctave);
-        chordGate[i] = true;
+        chordCode[i] = pitchVolt_to_code_ch(i, chordPitchV[i]);
     }
+    chordScheduleOn();
     
     // Update drone oscillator frequencies and trigger
     updateDroneFrequencies(intervals, chordRootNote, baseOctave);
     triggerDrone();
-    
-    chordDirty = true;
 }
 
 // Release chord
 static void releaseChord(uint8_t midiNote) {
     if (chordHeldNote == midiNote) {
         chordHeldNote = -1;
-        for (int i = 0; i < 4; i++) {
-            chordGate[i] = false;
-        }
+        chordScheduleOff();
         releaseDrone();
-        chordDirty = true;
     }
 }
 
 // Write chord pitches to Pitch DACs (using the 4 pitch outputs in chord mode)
 static void writeChordPitchesToPitchOutputs() {
     if (!chordDirty) return;
+    if (arpRunning) { chordDirty = false; return; }  // Pitch1 belongs to the arp
     
     // Pitch1 = DAC1.B, Pitch2 = DAC2.B, Pitch3 = Exp.DAC2, Pitch4 = Exp.DAC2
     mcp4822_write(PIN_CS_DAC1, CH_B, pitchVolt_to_code_ch(0, chordPitchV[0]));
@@ -615,7 +977,7 @@ static void diag_render() {
   snprintf(lineBuf,sizeof(lineBuf),"M1:%4u P1:%4u", gDiagCodes[0], gDiagCodes[1]); oled.setCursor(0,8); oled.print(lineBuf);
   snprintf(lineBuf,sizeof(lineBuf),"M2:%4u P2:%4u", gDiagCodes[2], gDiagCodes[3]); oled.setCursor(0,16); oled.print(lineBuf);
   snprintf(lineBuf,sizeof(lineBuf),"M3:%4u M4:%4u", gDiagCodes[4], gDiagCodes[6]); oled.setCursor(0,24); oled.print(lineBuf);
-  oled.display();
+  oledPager.poll();  // changed pages go out over the next passes
 }
 
 static void diag_tick() {
@@ -640,7 +1002,7 @@ static void diag_tick() {
   gDiagCodes[gDiagSel] = (uint16_t)code;
 }
 
-// MIDI callbacks - behavior depends on current mode (gOledPage)
+// MIDI callbacks - behavior depends on current mode (gModePage)
 // Pages 0-1: CV mode (ch1-4 CV/Gate with velocity to mod, ch10 drums)
 // Page 2: Chord mode (ch6 triggers chords on pitch/gate outputs, ch10 drums still work)
 void onNoteOn(byte ch, byte note, byte vel){
@@ -651,34 +1013,24 @@ void onNoteOn(byte ch, byte note, byte vel){
   if(ch==10){
     int idx=(int)note-(int)DRUM_BASE_NOTE;
     if(idx>=0 && idx<(int)DRUM_COUNT){
-      drumTrig[idx]=true;
-      drumUntilUs[idx]=micros()+DRUM_TRIG_US[idx];
-      drumDirty=true;
+      drumTrigFire((uint8_t)idx, vel);  // on edge now, off edge from the event wheel
     }
     return;
   }
   
   // Mode-based MIDI handling
-  if(gOledPage <= 1) {
+  if(gModePage <= 1) {
     // CV MODE: Channels 1-4 CV/Gate with velocity to mod outputs
-    float modV = (vel / 127.0f) * 5.0f;  // 0-5V velocity
-    if(ch==1){ 
-      v1.note=note; v1.modV=modV; updatePitch(v1); 
-      gate1=true; dirtyPitch1=true; dirtyMod1=true; 
-    }
-    else if(ch==2){ 
-      v2.note=note; v2.modV=modV; updatePitch(v2); 
-      gate2=true; dirtyPitch2=true; dirtyMod2=true; 
+    // (channel pressure then takes over the mod output, see onAfterTouch)
+    int8_t vi = cvVoiceForChannel(ch);
+    if(vi >= 0){
+      Voice& v = *kCvVoices[vi];
+      v.note=note; v.modV=(vel / 127.0f) * 5.0f; updatePitch(v);  // 0-5V velocity
+      cvPushPitch(vi); cvPushMod(vi);
+      cvFrameFlushNow(2*vi+1);   // pitch lands before loop() raises the gate
+      *kCvGates[vi]=true;
     }
-    else if(ch==3){ 
-      v3.note=note; v3.modV=modV; updatePitch(v3); 
-      gate3=true; dirtyPitch3=true; dirtyMod3=true; 
-    }
-    else if(ch==4){ 
-      v4.note=note; v4.modV=modV; updatePitch(v4); 
-      gate4=true; dirtyPitch4=true; dirtyMod4=true; 
-    }
-  } else if(gOledPage >= 2) {
+  } else if(gModePage >= 2) {
     // CHORD/DRONE MODE: Channel 6 triggers chords on pitch/gate outputs
     if(ch==CHORD_MIDI_CH){
       triggerChord(note);
@@ -689,27 +1041,58 @@ void onNoteOff(byte ch, byte note, byte){
   lastMidiCh=ch; lastMidiNote=note; lastMidiVel=0; lastMidiMs=millis();
   
   // Mode-based MIDI handling
-  if(gOledPage <= 1) {
+  if(gModePage <= 1) {
     // CV MODE
-    if(ch==1 && v1.note==note){ gate1=false; v1.note=-1; dirtyPitch1=true; }
-    else if(ch==2 && v2.note==note){ gate2=false; v2.note=-1; dirtyPitch2=true; }
-    else if(ch==3 && v3.note==note){ gate3=false; v3.note=-1; dirtyPitch3=true; }
-    else if(ch==4 && v4.note==note){ gate4=false; v4.note=-1; dirtyPitch4=true; }
-  } else if(gOledPage >= 2) {
+    int8_t vi = cvVoiceForChannel(ch);
+    if(vi >= 0 && kCvVoices[vi]->note==note){ *kCvGates[vi]=false; kCvVoices[vi]->note=-1; }
+  } else if(gModePage >= 2) {
     // CHORD/DRONE MODE
     if(ch==CHORD_MIDI_CH){
       releaseChord(note);
     }
   }
 }
+// Bend/pressure only store the new target; the CV frame writes it at its
+// next tick, so a dense stream can't flood the SPI bus
 void onPitchBend(byte ch, int value){
-  float semis=2.0f*(float)(value-8192)/8192.0f;
-  if(ch==1){ v1.bend=semis; if(v1.note>=0){ updatePitch(v1); dirtyPitch1=true; } }
-  else if(ch==2){ v2.bend=semis; if(v2.note>=0){ updatePitch(v2); dirtyPitch2=true; } }
-  else if(ch==3){ v3.bend=semis; if(v3.note>=0){ updatePitch(v3); dirtyPitch3=true; } }
-  else if(ch==4){ v4.bend=semis; if(v4.note>=0){ updatePitch(v4); dirtyPitch4=true; } }
+  if(ch<1 || ch>16) return;
+  float semis=bendRangeSemis[ch]*(float)(value-8192)/8192.0f;
+  if(mpeMembers && ch==MPE_MASTER_CH){
+    mpeMasterBend=semis;
+    for(uint8_t i=0;i<4;i++){ if(kCvVoices[i]->note>=0){ updatePitch(*kCvVoices[i]); cvPushPitch(i); } }
+    return;
+  }
+  int8_t vi = cvVoiceForChannel(ch);
+  if(vi < 0) return;
+  Voice& v = *kCvVoices[vi];
+  v.bend=semis; if(v.note>=0){ updatePitch(v); cvPushPitch(vi); }
+}
+void onAfterTouch(byte ch, byte pressure){
+  if(gModePage > 1) return;
+  int8_t vi = cvVoiceForChannel(ch);
+  if(vi < 0 || kCvVoices[vi]->note < 0) return;
+  kCvVoices[vi]->modV = (pressure / 127.0f) * 5.0f;  // 0-5V pressure
+  cvPushMod(vi);
+}
+// RPN data entry: 0 = bend range, 6 = MPE configuration (lower zone only)
+static void onRpnData(byte ch, byte val){
+  if(rpnMsb[ch]!=0) return;
+  if(rpnLsb[ch]==0){
+    bendRangeSemis[ch] = val > 96 ? 96 : val;
+  } else if(rpnLsb[ch]==6 && ch==MPE_MASTER_CH){
+    mpeMembers = val > 15 ? 15 : val;
+    // MPE defaults: master +/-2, members +/-48 semitones
+    for(uint8_t c=1;c<=16;c++) bendRangeSemis[c] = (mpeMembers && c!=MPE_MASTER_CH) ? 48 : 2;
+    mpeMasterBend = 0;
+    for(uint8_t i=0;i<4;i++){ kCvVoices[i]->bend=0; updatePitch(*kCvVoices[i]); cvPushPitch(i); }
+  }
 }
 void onControlChange(byte ch, byte cc, byte val){
+  if(ch>=1 && ch<=16){
+    if(cc==101){ rpnMsb[ch]=val; return; }
+    if(cc==100){ rpnLsb[ch]=val; return; }
+    if(cc==6){ onRpnData(ch, val); return; }
+  }
   // Chord mode drone controls (channel 6)
   if (ch == CHORD_MIDI_CH) {
     if (cc == 64) {
@@ -736,6 +1119,34 @@ void onControlChange(byte ch, byte cc, byte val){
       float releaseMs = 50.0f + (val / 127.0f) * 2950.0f;
       updateDroneRelease(releaseMs);
     }
+    else if (cc == 94) {
+      // CC 94 (Detune): Oscillator spread (0 - 50 cents)
+      updateDroneDetune((val / 127.0f) * 50.0f);
+    }
+    else if (cc == 70) {
+      // CC 70: Oscillators per voice (1 - DRONE_MAX_OSCS)
+      updateDroneOscCount(1 + (val * DRONE_MAX_OSCS) / 128);
+    }
+    else if (cc == 20) {
+      // CC 20: Strum spacing between voices (0 - 25 ms)
+      strumStepUs = (uint32_t)val * 25000u / 127u;
+    }
+    else if (cc == 21) {
+      // CC 21: Strum direction (Up / Down / Alternate)
+      strumDir = (StrumDir)((val * STRUM_DIR_COUNT) / 128);
+    }
+    else if (cc == 22) {
+      // CC 22: Arp mode (Off / Up / Down / UpDown) — applies from the next chord
+      arpMode = (ArpMode)((val * ARP_MODE_COUNT) / 128);
+    }
+    else if (cc == 23) {
+      // CC 23: Arp rate (1/4, 1/8, 1/8T, 1/16, 1/16T, 1/32)
+      arpDiv = (val * ARP_DIV_COUNT) / 128;
+    }
+    else if (cc == 24) {
+      // CC 24: Arp gate length (10 - 90 % of a step)
+      arpGatePct = 10 + (val * 80) / 127;
+    }
   }
 }
 
@@ -743,9 +1154,9 @@ void onControlChange(byte ch, byte cc, byte val){
 static volatile uint32_t midiTickCount=0; static const uint8_t PPQN=24, BEAT_DIV=24;
 static void resetMidiClockCounter(){ midiTickCount=BEAT_DIV-1; } // so first onClock() fires beat 1
 void onStart(){ rst=true; rstUntil=millis()+8; GATE_WRITE(PIN_RESET,true); resetMidiClockCounter(); }
-void onStop(){ gate1=false; gate2=false; clk=false; rst=false; GATE_WRITE(PIN_CLOCK,false); resetMidiClockCounter(); }
+void onStop(){ gate1=false; gate2=false; clk=false; rst=false; GATE_WRITE(PIN_CLOCK,false); resetMidiClockCounter(); arpClockStop(); }
 void onContinue(){ resetMidiClockCounter(); }
-void onClock(){ midiTickCount++; if(midiTickCount % BEAT_DIV == 0){ clk=true; clkUntil=millis()+PULSE_MS; GATE_WRITE(PIN_CLOCK,true); } }
+void onClock(){ midiTickCount++; if(midiTickCount % BEAT_DIV == 0){ clk=true; clkUntil=millis()+PULSE_MS; GATE_WRITE(PIN_CLOCK,true); } arpClockTick(midiTickCount); }
 
 // V2: Helper to update OLED row only if changed
 static void updateOledRow(uint8_t row, const char* newText) {
@@ -756,6 +1167,158 @@ static void updateOledRow(uint8_t row, const char* newText) {
   }
 }
 
+// ============================================================================
+// FOLLOW MODE — audio follower drives channel 3-4 outputs (long press, page 1)
+// ============================================================================
+// M3 = envelope, P3 = tracked pitch (1V/oct, same scale as MIDI notes),
+// G3 = voiced (level above the floor with a confident pitch),
+// M4 = brightness, P4 = strength of the last onset, G4 = trigger per onset.
+// The follower publishes once per audio block; loop() forwards the latest
+// frame to the CV frame, so output rate stays bounded by CV_FRAME_HZ.
+static FollowerFrame followFrame = {};
+static uint32_t followSeq = 0, followOnsets = 0;
+static const float FOLLOW_GATE_FLOOR = 0.01f;   // ~-40 dBFS
+static const float FOLLOW_MIN_CONF = 0.5f;
+static const uint32_t FOLLOW_TRIG_US = 5000;
+static bool followOffOwed = false;              // wheel was full: followTrigPoll() ends the trigger
+static uint32_t followOffUs = 0;
+
+// Event-wheel handler (timer ISR): end of the onset trigger
+static void evFollowTrigOff(uint8_t, uint16_t) {
+  gate4 = false;
+#ifndef DRUM_LANES_ON_EXP_GATES
+  expanderModify(0, 1u<<ExpanderBits::V2_GATE);
+#endif
+}
+
+static void setFollow(bool on) {
+  followOn = on;
+  follower.enable(on);
+  v3.note = -1; v4.note = -1;
+  gate3 = false; gate4 = false;
+  if (on) {
+    follower.read(followFrame, followSeq);   // skip anything stale
+    followOnsets = followFrame.onsets;
+  } else {
+    wheelCancel(evFollowTrigOff);
+    followOffOwed = false;
+    for (uint8_t i = 2; i < 4; i++) { cvPushPitch(i); cvPushMod(i); }
+  }
+}
+
+static void followTrigPoll() {
+  if (followOffOwed && (int32_t)(micros() - followOffUs) >= 0) {
+    followOffOwed = false;
+    evFollowTrigOff(0, 0);
+  }
+}
+
+static void followTick() {
+  if (!followOn || !follower.read(followFrame, followSeq)) return;
+  const FollowerFrame& f = followFrame;
+  cvFrameSet(4, f.env * 5.0f);                  // M3
+  cvFrameSet(6, f.bright * 5.0f);               // M4
+  cvFrameSet(7, f.onsetStrength * 5.0f);        // P4
+  bool voiced = f.env > FOLLOW_GATE_FLOOR && f.pitchConf > FOLLOW_MIN_CONF;
+  if (voiced) {
+    float note = 69.0f + 12.0f * log2f(f.pitchHz / 440.0f);
+    cvFrameSet(5, (note - 36.0f) / 12.0f);      // P3, same 1V/oct origin as midiNote_to_volts
+  }
+  gate3 = voiced;
+  if (f.onsets != followOnsets) {
+    followOnsets = f.onsets;
+    gate4 = true;
+    wheelCancel(evFollowTrigOff);
+    followOffUs = micros() + FOLLOW_TRIG_US;
+    followOffOwed = !wheelSchedule(followOffUs, evFollowTrigOff, 0, 0);
+  }
+}
+
+// ============================================================================
+// PROFILING — PROF page + serial report
+// ============================================================================
+struct AudioProfEntry { const char* name; AudioStream* obj; };
+static AudioProfEntry kAudioProf[] = {
+  {"i2sIn", &i2sIn}, {"i2sOut", &i2sOut},
+#ifdef USB_MIDI_AUDIO_SERIAL
+  {"usbOut", &usbOut},
+#endif
+  {"mixL", &outputMixL}, {"mixR", &outputMixR}, {"follow", &follower},
+};
+static const uint8_t AUDIO_PROF_COUNT = sizeof(kAudioProf) / sizeof(kAudioProf[0]);
+
+static void resetAudioPeaks() {
+  AudioProcessorUsageMaxReset();
+  AudioMemoryUsageMaxReset();
+  for (uint8_t i = 0; i < AUDIO_PROF_COUNT; i++) kAudioProf[i].obj->processorUsageMaxReset();
+#ifdef DRONE_LEGACY_GRAPH
+  droneMix.processorUsageMaxReset(); droneAmp.processorUsageMaxReset();
+  for (int i = 0; i < 4; i++) {
+    droneOscA[i].processorUsageMaxReset(); droneOscB[i].processorUsageMaxReset();
+    droneVoiceMix[i].processorUsageMaxReset(); droneEnv[i].processorUsageMaxReset();
+  }
+#else
+  droneEngine.processorUsageMaxReset();
+#endif
+}
+
+// Close the current window: snapshot for the PROF page, then reset
+static void closeProfWindow() {
+  profShown.loopAvgUs = loopAvgUs;         profShown.loopMaxUs = loopMaxUs;
+  profShown.oledAvgUs = profOled.avgUs();  profShown.oledMaxUs = profOled.maxUs();
+  profShown.dacMaxUs  = profDac.maxUs();   profShown.dacCount  = profDac.count;
+  profShown.midiMaxUs = profMidi.maxUs();  profShown.midiDrainMax = midiDrainMax;
+}
+
+static void printProfReport() {
+  Serial.printf("[prof] audio cpu=%.2f%% max=%.2f%% blocks=%d max=%d\n",
+                AudioProcessorUsage(), AudioProcessorUsageMax(), AudioMemoryUsage(), AudioMemoryUsageMax());
+  Serial.print("[prof] obj");
+  for (uint8_t i = 0; i < AUDIO_PROF_COUNT; i++) {
+    Serial.printf(" %s=%.2f/%.2f", kAudioProf[i].name, kAudioProf[i].obj->processorUsage(), kAudioProf[i].obj->processorUsageMax());
+  }
+  Serial.printf(" drone=%.2f/%.2f\n", droneCpuUsage(), droneCpuUsage(true));
+  Serial.printf("[prof] loop n=%lu avg=%luus max=%luus hist", loopCount, loopAvgUs, loopMaxUs);
+  for (uint8_t i = 0; i < LoopHistogram::BINS; i++) {
+    if (i < LoopHistogram::BINS - 1) Serial.printf(" <%u:%lu", LoopHistogram::kEdgesUs[i], loopHist.bins[i]);
+    else Serial.printf(" >=%u:%lu", LoopHistogram::kEdgesUs[i - 1], loopHist.bins[i]);
+  }
+  Serial.printf("\n[prof] oled n=%lu avg=%luus max=%luus  dac n=%lu avg=%luus max=%luus\n",
+                profOled.count, profOled.avgUs(), profOled.maxUs(), profDac.count, profDac.avgUs(), profDac.maxUs());
+  Serial.printf("[prof] oledpager pages=%lu errs=%lu page max=%luus pending=%u\n",
+                oledPager.pagesSent(), oledPager.busErrors(), oledPager.maxPageUs(), oledPager.pendingPages());
+  Serial.printf("[prof] midi msgs=%lu maxq=%u drain avg=%luus max=%luus\n",
+                midiMsgCount, midiDrainMax, profMidi.avgUs(), profMidi.maxUs());
+  Serial.printf("[prof] wheel depth=%u late max=%luus full=%lu clk=%luus\n",
+                wheelDepthMax(), wheelLateMaxUs(), wheelFullCount(), clkPeriodUs);
+  Serial.printf("[prof] cvframe %uHz ticks=%lu writes=%lu coalesced=%lu max=%luus\n",
+                CV_FRAME_HZ, cvFrameTicks(), cvFrameWrites(), cvFrameCoalesced(), cvFrameMaxUs());
+}
+
+#ifdef WHEEL_SELFTEST
+// Boot check for a full event wheel (serial only): with every slot taken, a
+// drum trigger and a future chord gate-off must still be released by loop()'s
+// poll. Fires drum lane 1 and gate 2 once at boot.
+static void evSelfTestNop(uint8_t, uint16_t) {}
+static void wheelSelfTest() {
+  while (!Serial && millis() < 1500) {}
+  uint8_t filled = 0;
+  while (wheelSchedule(micros() + 10000000u, evSelfTestNop, 0, 0)) filled++;
+  drumTrigFire(0, 127);
+  __disable_irq(); writeChordGate(1, true); __enable_irq();
+  chordGateOffAt(1, micros() + 1000);
+  bool heldDrum = drumTrigActive(0), heldGate = chordGate[1];
+  uint32_t t0 = micros();
+  while (micros() - t0 < 5000) { drumTrigPoll(); chordGatePoll(); }
+  bool ok = filled == WHEEL_CAPACITY && heldDrum && heldGate && !drumTrigActive(0) && !chordGate[1];
+  wheelCancel(evSelfTestNop);
+  Serial.printf("[wheel] selftest filled=%u/%u full=%lu drum %d->%d gate %d->%d: %s\n",
+                filled, WHEEL_CAPACITY, wheelFullCount(), heldDrum, drumTrigActive(0),
+                heldGate, (bool)chordGate[1], ok ? "PASS" : "FAIL");
+  wheelStatsReset();
+}
+#endif
+
 // Setup
 void setup(){
   // Force Full Speed USB (12 Mbps) for reliable operation through USB hubs.
@@ -774,11 +1337,17 @@ void setup(){
   GATE_WRITE(PIN_GATE1,false); GATE_WRITE(PIN_GATE2,false);
   SPI.begin();
   expanderInit(PIN_595_LATCH);
+  wheelInit();
+  drumTrigInit();
   mcp4822_write(PIN_CS_DAC1, CH_A, modVolt_to_code(0.0f));
   mcp4822_write(PIN_CS_DAC1, CH_B, pitchVolt_to_code(0.0f));
   mcp4822_write(PIN_CS_DAC2, CH_A, modVolt_to_code(0.0f));
   mcp4822_write(PIN_CS_DAC2, CH_B, pitchVolt_to_code(0.0f));
+#ifdef DRONE_LEGACY_GRAPH
   AudioMemory(24);  // Increased for drone voices
+#else
+  AudioMemory(12);  // Drone engine needs one block per update
+#endif
   initDrone();  // Initialize drone oscillators, envelopes, filter
   sgtl5000.enable();
   sgtl5000.inputSelect(AUDIO_INPUT_LINEIN);
@@ -790,6 +1359,7 @@ void setup(){
   Wire.setClock(400000);  // V2: Ensure 400kHz I2C for faster OLED
   if(oled.begin(SSD1306_SWITCHCAPVCC, 0x3C)){
     oled.clearDisplay(); oled.setTextSize(1); oled.setTextColor(SSD1306_WHITE); oled.setCursor(0,0); oled.display();
+    oledPager.begin(Wire, 400000);  // from here on the panel is flushed by the pager only
   }
   analogReadResolution(12);
   // Boot-hold diagnostics: hold BTN during boot
@@ -797,11 +1367,17 @@ void setup(){
   usbMIDI.setHandleNoteOn(onNoteOn);
   usbMIDI.setHandleNoteOff(onNoteOff);
   usbMIDI.setHandlePitchChange(onPitchBend);
+  usbMIDI.setHandleAfterTouchChannel(onAfterTouch);
   usbMIDI.setHandleControlChange(onControlChange);
   usbMIDI.setHandleStart(onStart);
   usbMIDI.setHandleStop(onStop);
   usbMIDI.setHandleClock(onClock);
   usbMIDI.setHandleContinue(onContinue);
+  for(uint8_t c=0;c<=16;c++){ bendRangeSemis[c]=2; rpnMsb[c]=127; rpnLsb[c]=127; }
+  if(!gDiagMode) cvFrameBegin(kCvPorts, 8);
+#ifdef WHEEL_SELFTEST
+  wheelSelfTest();
+#endif
   
   // V2: Initialize loop timing
   lastLoopStatsMs = millis();
@@ -814,7 +1390,16 @@ void loop(){
   // Diagnostics mode
   if(gDiagMode){ while(usbMIDI.read()) {} diag_tick(); diag_render(); delay(10); return; }
   
-  while(usbMIDI.read()) {}  // drain ALL pending MIDI — critical for clock timing
+  {
+    ProfScope prof(profMidi);
+    uint16_t drained = 0;
+    while(usbMIDI.read()) { drained++; }  // drain ALL pending MIDI — critical for clock timing
+    if (drained > midiDrainMax) midiDrainMax = drained;
+    midiMsgCount += drained;
+  }
+  drumTrigPoll();     // off edges the event wheel had no room for
+  chordGatePoll();
+  followTrigPoll();
   
   // Read pots for chord parameters when in chord mode
   if (gOledPage == 2) {
@@ -870,80 +1455,62 @@ void loop(){
         // Long press action depends on page
         if(gOledPage == 2 || gOledPage == 3) {
           toggleDrone();  // Chord/Drone page: toggle drone
+        } else if(gOledPage == PAGE_PROF) {
+          resetAudioPeaks();  // Profiling page: clear audio high-water marks
+        } else if(gOledPage == 1) {
+          setFollow(!followOn);  // CH3-4 page: audio follower on/off
         } else {
           rst=true; rstUntil=btnNow+8;  // CV pages: reset pulse
         }
       }
-      else { gOledPage = (gOledPage + 1) % 4; }  // short press = toggle page (4 pages)
+      else {  // short press = next page; PROF keeps the previous mode
+        gOledPage = (gOledPage + 1) % OLED_PAGE_COUNT;
+        if (gOledPage != PAGE_PROF) gModePage = gOledPage;
+      }
     }
     btnPrev=b;
   }
   uint32_t now=millis();
-  uint32_t nowUs=micros();
   if(clkUntil && (int32_t)(now-(int32_t)clkUntil)>=0){ clk=false; clkUntil=0; }
   if(rstUntil && (int32_t)(now-(int32_t)rstUntil)>=0){ rst=false; rstUntil=0; }
-  for (uint8_t i=0;i<DRUM_COUNT;i++){
-    uint32_t untilUs = drumUntilUs[i];
-    if (untilUs && (int32_t)(nowUs - untilUs) >= 0) {
-      drumTrig[i]=false;
-      drumUntilUs[i]=0;
-      drumDirty=true;
-    }
-  }
   
   // Mode-dependent gate outputs for gates 1-2 (directly on Teensy pins)
   GATE_WRITE(PIN_CLOCK, clk); GATE_WRITE(PIN_RESET, rst);
-  if(gOledPage >= 2) {
-    // CHORD/DRONE MODE: Use gate1/2 for chord voice 1/2 gates
-    GATE_WRITE(PIN_GATE1, chordGate[0]); GATE_WRITE(PIN_GATE2, chordGate[1]);
-  } else {
+  // CHORD/DRONE MODE: chord gates 1-4 are written by event-wheel handlers;
+  // only resync them on the way in and drop queued edges on the way out
+  {
+    static bool chordOwnsGates = false;
+    bool chordMode = (gModePage >= 2);
+    if (chordMode != chordOwnsGates) {
+      chordOwnsGates = chordMode;
+      if (chordMode) chordGatesResync(); else { arpRunning = false; chordEventsCancel(); }
+    }
+  }
+  if(gModePage <= 1) {
     // CV MODE: Normal gate1/2
     GATE_WRITE(PIN_GATE1, gate1); GATE_WRITE(PIN_GATE2, gate2);
   }
   
   // Mode-based CV outputs
-  if(gOledPage <= 1) {
-    // CV MODE: Write pitch and mod (velocity) CVs for channels 1-4
-    if(dirtyPitch1){ mcp4822_write(PIN_CS_DAC1, CH_B, pitchVolt_to_code_ch(0, v1.pitchHeldV)); dirtyPitch1=false; }
-    if(dirtyPitch2){ mcp4822_write(PIN_CS_DAC2, CH_B, pitchVolt_to_code_ch(1, v2.pitchHeldV)); dirtyPitch2=false; }
-    if(dirtyPitch3){ mcp4822_write_expander(1, EXP_PITCH3_CH_IDX, pitchVolt_to_code_ch(2, v3.pitchHeldV)); dirtyPitch3=false; }
-    if(dirtyPitch4){ mcp4822_write_expander(1, EXP_PITCH4_CH_IDX, pitchVolt_to_code_ch(3, v4.pitchHeldV)); dirtyPitch4=false; }
-    // Mod outputs = velocity
-    if(dirtyMod1){ mcp4822_write(PIN_CS_DAC1, CH_A, modVolt_to_code_ch(0, v1.modV)); dirtyMod1=false; }
-    if(dirtyMod2){ mcp4822_write(PIN_CS_DAC2, CH_A, modVolt_to_code_ch(1, v2.modV)); dirtyMod2=false; }
-    if(dirtyMod3){ mcp4822_write_expander(0, EXP_MOD3_CH_IDX, modVolt_to_code_ch(2, v3.modV)); dirtyMod3=false; }
-    if(dirtyMod4){ mcp4822_write_expander(0, EXP_MOD4_CH_IDX, modVolt_to_code_ch(3, v4.modV)); dirtyMod4=false; }
-  } else {
+  // CV MODE: pitch + mod (velocity/pressure) CVs are written by the CV frame tick
+  cvFrameEnable(gModePage <= 1);
+  if(gModePage <= 1) followTick();
+  if(gModePage >= 2) {
     // CHORD MODE: Write chord pitches to pitch outputs
     writeChordPitchesToPitchOutputs();
   }
   
   if (now - lastBeat >= 1000) { lastBeat = now; digitalToggle(LED_BUILTIN); }
-  // Combined expander image update: gates + drums (drums work in both modes)
-  {
-    uint8_t img = expanderImage(); uint8_t newImg = img;
-    
-    // Gates 3-4 from expander - mode dependent
-    if(gOledPage >= 2) {
-      // CHORD/DRONE MODE: Use gate3/4 for chord voice 3/4 gates
-      if (chordGate[2]) newImg &= ~(1u<<ExpanderBits::V1_GATE); else newImg |= (1u<<ExpanderBits::V1_GATE);
-      if (chordGate[3]) newImg &= ~(1u<<ExpanderBits::V2_GATE); else newImg |= (1u<<ExpanderBits::V2_GATE);
-    } else {
-      // CV MODE: Normal gate3/4
-      if (gate3) newImg &= ~(1u<<ExpanderBits::V1_GATE); else newImg |= (1u<<ExpanderBits::V1_GATE);
-      if (gate4) newImg &= ~(1u<<ExpanderBits::V2_GATE); else newImg |= (1u<<ExpanderBits::V2_GATE);
-    }
-    
-    // Drum outputs (Q2-Q5) - work in BOTH modes
-    uint8_t drumsMask=(1u<<ExpanderBits::DRUM1)|(1u<<ExpanderBits::DRUM2)|(1u<<ExpanderBits::DRUM3)|(1u<<ExpanderBits::DRUM4);
-    newImg |= drumsMask;  // All off by default
-    for(uint8_t i=0;i<DRUM_COUNT;i++){
-      if(drumTrig[i]) newImg &= ~(1u<<(ExpanderBits::DRUM1+i));  // Active = LOW
-    }
-    
-    newImg |= (1u<<ExpanderBits::DAC1_CS) | (1u<<ExpanderBits::DAC2_CS);
-    if(newImg!=img){ expanderWrite(newImg); drumDirty=false; }
+  // Expander gates 3-4 in CV mode (drum bits belong to drum_trig.cpp,
+  // chord gates to the event wheel)
+#ifndef DRUM_LANES_ON_EXP_GATES
+  if(gModePage <= 1) {
+    uint8_t on = 0, off = 0;
+    if (gate3) on |= (1u<<ExpanderBits::V1_GATE); else off |= (1u<<ExpanderBits::V1_GATE);
+    if (gate4) on |= (1u<<ExpanderBits::V2_GATE); else off |= (1u<<ExpanderBits::V2_GATE);
+    expanderModify(on, off);  // Active = LOW; no SPI traffic if unchanged
   }
+#endif
   
   // V2: OLED update with reduced impact
   if (now - lastOledPaintMs >= OLED_FPS_MS) {
@@ -960,7 +1527,7 @@ void loop(){
       updateOledRow(1, lineBuf);
       
       // Show drum triggers status
-      char d1=drumTrig[0]?'#':'-', d2=drumTrig[1]?'#':'-', d3=drumTrig[2]?'#':'-', d4=drumTrig[3]?'#':'-';
+      char d1=drumTrigActive(0)?'#':'-', d2=drumTrigActive(1)?'#':'-', d3=drumTrigActive(2)?'#':'-', d4=drumTrigActive(3)?'#':'-';
       snprintf(lineBuf,sizeof(lineBuf),"Drums:%c%c%c%c CLK:%c", d1, d2, d3, d4, clk?'#':'-');
       updateOledRow(2, lineBuf);
       
@@ -968,22 +1535,28 @@ void loop(){
       if (now - lastMidiMs <= 1000) {
         snprintf(lineBuf,sizeof(lineBuf),"MIDI ch:%2u n:%3u v:%3u", lastMidiCh, lastMidiNote, lastMidiVel);
       } else {
-        snprintf(lineBuf,sizeof(lineBuf),"ch1-4:CV ch10:Drum");
+        if (mpeMembers) snprintf(lineBuf,sizeof(lineBuf),"MPE ch2-%u ch10:Drum", 1 + (mpeMembers < 4 ? mpeMembers : 4));
+        else snprintf(lineBuf,sizeof(lineBuf),"ch1-4:CV ch10:Drum");
       }
       updateOledRow(3, lineBuf);
       
     } else if(gOledPage == 1) {
       // Page 1: CV MODE - Channels 3-4
-      snprintf(lineBuf,sizeof(lineBuf),"CV MODE  G3:%c G4:%c", gate3?'#':'-', gate4?'#':'-');
+      snprintf(lineBuf,sizeof(lineBuf),"%s G3:%c G4:%c", followOn ? "FOLLOW  " : "CV MODE ", gate3?'#':'-', gate4?'#':'-');
       updateOledRow(0, lineBuf);
       
-      float vP3 = teensy_move_calib::PITCH_M[2]*pitchVolt_to_code_ch(2, v3.pitchHeldV) + teensy_move_calib::PITCH_C[2];
-      float vP4 = teensy_move_calib::PITCH_M[3]*pitchVolt_to_code_ch(3, v4.pitchHeldV) + teensy_move_calib::PITCH_C[3];
-      snprintf(lineBuf,sizeof(lineBuf),"P3:%+.2fV  P4:%+.2fV", vP3, vP4);
+      if (followOn) {
+        snprintf(lineBuf,sizeof(lineBuf),"Env:%3.0f%% %4.0fHz %c", followFrame.env * 100.0f,
+                 followFrame.pitchHz, followFrame.pitchConf > FOLLOW_MIN_CONF ? '*' : ' ');
+      } else {
+        float vP3 = teensy_move_calib::PITCH_M[2]*pitchVolt_to_code_ch(2, v3.pitchHeldV) + teensy_move_calib::PITCH_C[2];
+        float vP4 = teensy_move_calib::PITCH_M[3]*pitchVolt_to_code_ch(3, v4.pitchHeldV) + teensy_move_calib::PITCH_C[3];
+        snprintf(lineBuf,sizeof(lineBuf),"P3:%+.2fV  P4:%+.2fV", vP3, vP4);
+      }
       updateOledRow(1, lineBuf);
       
       // Show drum triggers status
-      char d1=drumTrig[0]?'#':'-', d2=drumTrig[1]?'#':'-', d3=drumTrig[2]?'#':'-', d4=drumTrig[3]?'#':'-';
+      char d1=drumTrigActive(0)?'#':'-', d2=drumTrigActive(1)?'#':'-', d3=drumTrigActive(2)?'#':'-', d4=drumTrigActive(3)?'#':'-';
       snprintf(lineBuf,sizeof(lineBuf),"Drums:%c%c%c%c RST:%c", d1, d2, d3, d4, rst?'#':'-');
       updateOledRow(2, lineBuf);
       
@@ -991,7 +1564,8 @@ void loop(){
       if (now - lastMidiMs <= 1000) {
         snprintf(lineBuf,sizeof(lineBuf),"MIDI ch:%2u n:%3u v:%3u", lastMidiCh, lastMidiNote, lastMidiVel);
       } else {
-        snprintf(lineBuf,sizeof(lineBuf),"ch1-4:CV ch10:Drum");
+        if (mpeMembers) snprintf(lineBuf,sizeof(lineBuf),"MPE ch2-%u ch10:Drum", 1 + (mpeMembers < 4 ? mpeMembers : 4));
+        else snprintf(lineBuf,sizeof(lineBuf),"ch1-4:CV ch10:Drum");
       }
       updateOledRow(3, lineBuf);
       
@@ -1014,8 +1588,12 @@ void loop(){
       
       // Show gates, drums, and audio CPU
       char g1=chordGate[0]?'#':'-', g2=chordGate[1]?'#':'-', g3=chordGate[2]?'#':'-', g4=chordGate[3]?'#':'-';
-      char d1=drumTrig[0]?'#':'-', d2=drumTrig[1]?'#':'-', d3=drumTrig[2]?'#':'-', d4=drumTrig[3]?'#':'-';
-      snprintf(lineBuf,sizeof(lineBuf),"G:%c%c%c%c D:%c%c%c%c", g1, g2, g3, g4, d1, d2, d3, d4);
+      char d1=drumTrigActive(0)?'#':'-', d2=drumTrigActive(1)?'#':'-', d3=drumTrigActive(2)?'#':'-', d4=drumTrigActive(3)?'#':'-';
+      if (arpMode != ARP_OFF) {
+        snprintf(lineBuf,sizeof(lineBuf),"G:%c%c%c%c D:%c%c%c%c A:%s", g1, g2, g3, g4, d1, d2, d3, d4, kArpModeNames[arpMode]);
+      } else {
+        snprintf(lineBuf,sizeof(lineBuf),"G:%c%c%c%c D:%c%c%c%c S:%lums", g1, g2, g3, g4, d1, d2, d3, d4, strumStepUs / 1000);
+      }
       updateOledRow(3, lineBuf);
     } else if(gOledPage == 3) {
       // Page 3: DRONE MODE - synth parameters
@@ -1027,7 +1605,7 @@ void loop(){
       for (uint8_t i = 0; i < NUM_WAVEFORMS; i++) {
         if (waveformTypes[i] == droneWaveform) { waveIdx = i; break; }
       }
-      snprintf(lineBuf,sizeof(lineBuf),"Wave: %s", waveformNames[waveIdx]);
+      snprintf(lineBuf,sizeof(lineBuf),"Wave:%s x%u CPU:%.1f%%", waveformNames[waveIdx], droneOscCount, droneCpuUsage());
       updateOledRow(1, lineBuf);
       
       snprintf(lineBuf,sizeof(lineBuf),"A:%.0fms R:%.0fms", droneAttackMs, droneReleaseMs);
@@ -1035,33 +1613,53 @@ void loop(){
       
       snprintf(lineBuf,sizeof(lineBuf),"Volume: %.0f%%", droneLevel * 67);
       updateOledRow(3, lineBuf);
+    } else if(gOledPage == PAGE_PROF) {
+      // Page 4: PROFILING - audio CPU/blocks live, loop/OLED/DAC from last window
+      snprintf(lineBuf,sizeof(lineBuf),"PROF A:%.1f%% pk:%.1f%%", AudioProcessorUsage(), AudioProcessorUsageMax());
+      updateOledRow(0, lineBuf);
+      snprintf(lineBuf,sizeof(lineBuf),"Blk:%d/%d Drn:%.1f%%", AudioMemoryUsage(), AudioMemoryUsageMax(), droneCpuUsage(true));
+      updateOledRow(1, lineBuf);
+      snprintf(lineBuf,sizeof(lineBuf),"Loop av:%lu mx:%luus", profShown.loopAvgUs, profShown.loopMaxUs);
+      updateOledRow(2, lineBuf);
+      snprintf(lineBuf,sizeof(lineBuf),"OL:%lu DAC:%lu Q:%u", profShown.oledMaxUs, profShown.dacMaxUs, profShown.midiDrainMax);
+      updateOledRow(3, lineBuf);
     }
     
-    // Only do full refresh if any row changed
-    bool anyDirty = oledRowDirty[0] || oledRowDirty[1] || oledRowDirty[2] || oledRowDirty[3];
-    if (anyDirty) {
-      oled.clearDisplay();
-      for (uint8_t r = 0; r < 4; r++) {
-        oled.setCursor(0, r * 8);
-        oled.print(oledRowCache[r]);
-        oledRowDirty[r] = false;
-      }
-      oled.display();
-    }
     lastOledPaintMs = now;
   }
+
+  // Redraw at most one changed row per pass, then let the pager start the
+  // next changed page. Neither touches the bus synchronously.
+  {
+    ProfScope prof(profOled);
+    for (uint8_t r = 0; r < 4; r++) {
+      if (!oledRowDirty[r]) continue;
+      oled.fillRect(0, r * 8, OLED_W, 8, SSD1306_BLACK);
+      oled.setCursor(0, r * 8);
+      oled.print(oledRowCache[r]);
+      oledRowDirty[r] = false;
+      break;
+    }
+    oledPager.poll();
+  }
   
   // V2: Loop timing diagnostics (optional serial output)
   uint32_t loopElapsedUs = micros() - loopStartUs;
   if (loopElapsedUs > loopMaxUs) loopMaxUs = loopElapsedUs;
   loopAvgUs = (loopAvgUs * loopCount + loopElapsedUs) / (loopCount + 1);
   loopCount++;
+  loopHist.add(loopElapsedUs);
   
   if (now - lastLoopStatsMs >= LOOP_STATS_INTERVAL_MS) {
-    // Uncomment for debugging: Serial.printf("Loop: max=%luus avg=%luus\n", loopMaxUs, loopAvgUs);
+    closeProfWindow();
+    if (Serial) printProfReport();  // only when a terminal holds DTR
     loopMaxUs = 0;
     loopAvgUs = 0;
     loopCount = 0;
+    loopHist.reset();
+    profOled.reset(); profDac.reset(); profMidi.reset(); wheelStatsReset(); cvFrameStatsReset();
+    oledPager.statsReset();
+    midiDrainMax = 0; midiMsgCount = 0;
     lastLoopStatsMs = now;
   }
 }
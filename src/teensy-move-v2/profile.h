@@ -0,0 +1,39 @@
+#pragma once
+#include <Arduino.h>
+
+// Control-loop profiling helpers (DWT cycle counter, enabled by the Teensy 4
+// startup code). Only touched from loop(), so no locking — ISR code paths
+// must not use these (main.cpp's wheel handlers use the untimed DAC writes).
+
+static inline uint32_t profCyclesToUs(uint32_t cyc) { return cyc / (F_CPU_ACTUAL / 1000000); }
+
+// Count / average / max of one timed section
+struct ProfStat {
+  uint32_t count = 0, maxCyc = 0;
+  uint64_t totalCyc = 0;
+  inline void add(uint32_t cyc) { count++; totalCyc += cyc; if (cyc > maxCyc) maxCyc = cyc; }
+  uint32_t avgUs() const { return count ? profCyclesToUs((uint32_t)(totalCyc / count)) : 0; }
+  uint32_t maxUs() const { return profCyclesToUs(maxCyc); }
+  void reset() { count = 0; maxCyc = 0; totalCyc = 0; }
+};
+
+// Times the enclosing scope into a ProfStat
+struct ProfScope {
+  ProfStat& stat; uint32_t t0;
+  explicit ProfScope(ProfStat& s) : stat(s), t0(ARM_DWT_CYCCNT) {}
+  ~ProfScope() { stat.add(ARM_DWT_CYCCNT - t0); }
+};
+
+// Loop-time histogram: bucket i counts loops shorter than kEdgesUs[i],
+// the last bucket everything at or above the final edge
+struct LoopHistogram {
+  static const uint8_t BINS = 8;
+  static constexpr uint16_t kEdgesUs[BINS - 1] = { 50, 100, 250, 500, 1000, 2500, 5000 };
+  uint32_t bins[BINS] = {0};
+  inline void add(uint32_t us) {
+    uint8_t i = 0;
+    while (i < BINS - 1 && us >= kEdgesUs[i]) i++;
+    bins[i]++;
+  }
+  void reset() { for (uint8_t i = 0; i < BINS; i++) bins[i] = 0; }
+};
@@ -6,8 +6,21 @@ static uint8_t g_latchPin = 255;
 // If your expander hardware inverts these lines (e.g. via a 74HCT14), then:
 //   - Q HIGH -> jack LOW
 //   - Q LOW  -> jack HIGH
-// The main loop updates these bits continuously; this just defines a safe power-on image.
-static uint8_t g_image = 0xFF; // Q HIGH (DAC CS inactive; others depend on downstream inversion)
+// The main loop / chord events own the gate bits, the drum events own the
+// drum bits; all go through expanderModify(). This just defines a safe power-on image.
+static volatile uint8_t g_image = 0xFF; // Q HIGH (DAC CS inactive; others depend on downstream inversion)
+
+static const SPISettings kExpanderSpi(4000000, MSBFIRST, SPI_MODE0);
+
+// Shift + latch; caller holds the SPI transaction
+static inline void shiftLatch(uint8_t image){
+  SPI.transfer(image);
+  // Latch rising edge
+  digitalWriteFast(g_latchPin, HIGH);
+  // short pulse for reliability
+  delayMicroseconds(1);
+  digitalWriteFast(g_latchPin, LOW);
+}
 
 void expanderInit(uint8_t latchPin){
   g_latchPin = latchPin;
@@ -18,15 +31,33 @@ void expanderInit(uint8_t latchPin){
 }
 
 void expanderWrite(uint8_t image){
+  SPI.beginTransaction(kExpanderSpi);
   g_image = image;
-  SPI.beginTransaction(SPISettings(4000000, MSBFIRST, SPI_MODE0));
-  SPI.transfer(g_image);
+  shiftLatch(image);
+  SPI.endTransaction();
+}
+
+uint8_t expanderModify(uint8_t clearMask, uint8_t setMask){
+  SPI.beginTransaction(kExpanderSpi);
+  uint8_t img = (uint8_t)((g_image & ~clearMask) | setMask);
+  if (img != g_image) { g_image = img; shiftLatch(img); }
+  SPI.endTransaction();
+  return img;
+}
+
+void expanderDacWriteLocked(uint8_t csBit, uint16_t frame){
+  const uint8_t csMask = (1u<<ExpanderBits::DAC1_CS) | (1u<<ExpanderBits::DAC2_CS);
+  uint8_t idle = g_image | csMask;
+  shiftLatch(idle & ~(1u<<csBit));
+  SPI.transfer16(frame);
+  shiftLatch(idle);
+  g_image = idle;
+}
+
+void expanderDacWrite(uint8_t csBit, uint16_t frame){
+  SPI.beginTransaction(kExpanderSpi);
+  expanderDacWriteLocked(csBit, frame);
   SPI.endTransaction();
-  // Latch rising edge
-  digitalWrite(g_latchPin, HIGH);
-  // short pulse for reliability
-  delayMicroseconds(1);
-  digitalWrite(g_latchPin, LOW);
 }
 
 uint8_t expanderImage(){ return g_image; }
@@ -17,3 +17,16 @@ namespace ExpanderBits {
 void expanderInit(uint8_t latchPin);
 void expanderWrite(uint8_t image);
 uint8_t expanderImage();
+
+// Interrupt-safe variants. The image read-modify-write and the shift/latch
+// run inside one SPI transaction, so with SPI.usingInterrupt() registered for
+// the timer IRQ (see event_wheel.cpp) a timer ISR can never land between them.
+uint8_t expanderModify(uint8_t clearMask, uint8_t setMask);
+// Expander-CS DAC write as a single transaction: assert CS bit, 16-bit frame,
+// deassert — no foreign 595 shift can reach the DAC while its CS is low.
+void expanderDacWrite(uint8_t csBit, uint16_t frame);
+// Same, for callers batching several writes inside their own transaction
+void expanderDacWriteLocked(uint8_t csBit, uint16_t frame);
+
+// MCP4822 command word: channel select, 1x gain, active, 12-bit code
+static inline uint16_t frame4822(uint8_t ch, uint16_t v){ return (ch?0x8000:0)|0x1000|(v & 0x0FFF); }
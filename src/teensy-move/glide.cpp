@@ -0,0 +1,115 @@
+#include "glide.h"
+#include <SPI.h>
+#include "teensy-move/calib_static.h"
+
+struct GlideState {
+  int32_t  cur = 0, target = 0;   // Q16 DAC codes
+  int32_t  step = 0;              // linear: Q16 codes per tick
+  int32_t  k = 0;                 // exponential: Q16 fraction of the gap per tick
+  uint16_t lastCode = 0xFFFF;
+  GlideShape shape = GLIDE_LINEAR;
+  bool     active = false;
+};
+
+static GlideConfig g_cfg[GLIDE_VOICES];
+static volatile GlideState g_st[GLIDE_VOICES];
+static GlideWriteFn g_write = nullptr;
+static IntervalTimer g_glideTimer;
+
+static const int32_t kCodeMaxQ16 = 4095 << 16;
+
+// Calibrated volts -> Q16 DAC code (same fit as pitchVoltsToCode, unrounded)
+static int32_t voltsToCodeQ16(uint8_t v, float volts){
+  float codef = (volts - teensy_move_calib::PITCH_C[v & 3]) / teensy_move_calib::PITCH_M[v & 3];
+  int32_t q = (int32_t)(codef * 65536.0f);
+  return q < 0 ? 0 : (q > kCodeMaxQ16 ? kCodeMaxQ16 : q);
+}
+
+static inline uint16_t q16ToCode(int32_t q){ return (uint16_t)((q + 0x8000) >> 16); }
+
+static void glideIsr(){
+  for (uint8_t v = 0; v < GLIDE_VOICES; v++) {
+    volatile GlideState& s = g_st[v];
+    if (!s.active) continue;
+    int32_t gap = s.target - s.cur;
+    if (s.shape == GLIDE_LINEAR) {
+      s.cur += s.step;
+      if ((s.step > 0) ? (s.cur >= s.target) : (s.cur <= s.target)) { s.cur = s.target; s.active = false; }
+    } else {
+      int32_t inc = (int32_t)(((int64_t)gap * s.k) >> 16);
+      if (!inc) inc = gap > 0 ? 1 : -1;
+      s.cur += inc;
+      if (abs(s.target - s.cur) < 0x8000) { s.cur = s.target; s.active = false; }  // within half a code
+    }
+    uint16_t code = q16ToCode(s.cur);
+    if (code != s.lastCode) { s.lastCode = code; g_write(v, code); }
+  }
+}
+
+void glideBegin(GlideWriteFn write){
+  g_write = write;
+  // loop()'s DAC/595 transactions mask the PIT while they hold the bus
+  SPI.usingInterrupt(IRQ_PIT);
+  g_glideTimer.priority(48);
+  g_glideTimer.begin(glideIsr, 1000000.0f / GLIDE_RATE_HZ);
+}
+
+GlideConfig& glideConfig(uint8_t voice){ return g_cfg[voice & 3]; }
+
+static void jumpTo(uint8_t v, int32_t tgt){
+  uint16_t code = q16ToCode(tgt);
+  __disable_irq();
+  volatile GlideState& s = g_st[v];
+  s.active = false; s.cur = tgt; s.target = tgt;
+  bool changed = (code != s.lastCode);
+  s.lastCode = code;
+  __enable_irq();
+  if (changed) g_write(v, code);
+}
+
+void glideNote(uint8_t voice, float volts, bool legato){
+  if (voice >= GLIDE_VOICES) return;
+  const GlideConfig& c = g_cfg[voice];
+  int32_t tgt = voltsToCodeQ16(voice, volts);
+  if (!c.timeMs || (c.legatoOnly && !legato)) { jumpTo(voice, tgt); return; }
+
+  __disable_irq(); int32_t cur = g_st[voice].cur; __enable_irq();
+  int32_t gap = tgt - cur;
+  // Glide length in ticks; constant-rate scales by the interval in octaves
+  // (1 V/oct, so volts-per-code from the calibration slope)
+  float ticks = c.timeMs * (GLIDE_RATE_HZ / 1000.0f);
+  if (c.law == GLIDE_CONST_RATE) ticks *= fabsf(gap / 65536.0f * teensy_move_calib::PITCH_M[voice]);
+  if (ticks < 1.0f || gap == 0) { jumpTo(voice, tgt); return; }
+
+  int32_t step = 0, k = 0;
+  if (c.shape == GLIDE_LINEAR) {
+    step = (int32_t)(gap / ticks);
+    if (!step) step = gap > 0 ? 1 : -1;
+  } else {
+    // Time constant = ticks/4: within 2 % of the target after timeMs
+    k = (int32_t)((1.0f - expf(-4.0f / ticks)) * 65536.0f);
+    if (k < 1) k = 1;
+  }
+  __disable_irq();
+  volatile GlideState& s = g_st[voice];
+  s.target = tgt; s.step = step; s.k = k; s.shape = c.shape; s.active = true;
+  __enable_irq();
+}
+
+void glideShift(uint8_t voice, float volts){
+  if (voice >= GLIDE_VOICES) return;
+  int32_t tgt = voltsToCodeQ16(voice, volts);
+  __disable_irq();
+  volatile GlideState& s = g_st[voice];
+  if (s.active) {
+    int32_t cur = s.cur + (tgt - s.target);
+    s.cur = cur < 0 ? 0 : (cur > kCodeMaxQ16 ? kCodeMaxQ16 : cur);
+    s.target = tgt;
+    __enable_irq();
+    return;
+  }
+  __enable_irq();
+  jumpTo(voice, tgt);
+}
+
+bool glideActive(uint8_t voice){ return voice < GLIDE_VOICES && g_st[voice].active; }
@@ -0,0 +1,37 @@
+#pragma once
+#include <Arduino.h>
+
+// Per-voice portamento on the four pitch outputs.
+// Glides run in DAC-code space (Q16, through the static calibration fit) on
+// a fixed-rate IntervalTimer, so the slope doesn't depend on loop() timing
+// and the same glide always produces the same code sequence. Only voices
+// that are gliding use the SPI bus, and only when their code changes.
+
+#ifndef GLIDE_RATE_HZ
+#define GLIDE_RATE_HZ 2000
+#endif
+
+static const uint8_t GLIDE_VOICES = 4;
+
+enum GlideShape : uint8_t { GLIDE_LINEAR, GLIDE_EXP };
+// CONST_TIME: every glide takes timeMs. CONST_RATE: timeMs per octave.
+enum GlideLaw : uint8_t { GLIDE_CONST_TIME, GLIDE_CONST_RATE };
+
+struct GlideConfig {
+  uint16_t   timeMs = 0;                // 0 = off (jump)
+  GlideShape shape = GLIDE_LINEAR;
+  GlideLaw   law = GLIDE_CONST_TIME;
+  bool       legatoOnly = false;        // glide only into overlapping notes
+};
+
+typedef void (*GlideWriteFn)(uint8_t voice, uint16_t code);
+
+void glideBegin(GlideWriteFn write);    // after SPI.begin(); starts the timer
+GlideConfig& glideConfig(uint8_t voice);
+// New note target. Glides or jumps per the voice's config; legato = the
+// previous note on this voice was still held.
+void glideNote(uint8_t voice, float volts, bool legato);
+// Move the target without restarting (pitch bend): a running glide is
+// offset by the same amount, otherwise the output jumps.
+void glideShift(uint8_t voice, float volts);
+bool glideActive(uint8_t voice);
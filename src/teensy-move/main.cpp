@@ -8,13 +8,16 @@
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
 #include <Audio.h>
+#include "oled_pager/OledPager.h"
 #include "spi_bus.h"
+#include "glide.h"
 #include "teensy-move/pins.h"
 #include "teensy-move/calib_static.h"
 
 #define OLED_W 128
 #define OLED_H 32
 Adafruit_SSD1306 oled(OLED_W, OLED_H, &Wire, -1);
+static oled_pager::OledPager oledPager(oled);
 
 AudioInputI2S        i2sIn;
 AudioOutputI2S       i2sOut;
@@ -67,17 +70,9 @@ static inline void mcp4822_write(uint8_t cs, uint8_t ch, uint16_t v){
   SPI.endTransaction();
 }
 
-// Expander DACs via Q6/Q7 CS
+// Expander DACs via Q6/Q7 CS (one SPI transaction, safe against the glide ISR)
 static inline void mcp4822_write_expander(uint8_t whichDac /*0->Q6,1->Q7*/, uint8_t ch, uint16_t v){
-  uint8_t img = expanderImage();
-  img |= (1u<<ExpanderBits::DAC1_CS) | (1u<<ExpanderBits::DAC2_CS);
-  if (whichDac == 0) img &= ~(1u<<ExpanderBits::DAC1_CS); else img &= ~(1u<<ExpanderBits::DAC2_CS);
-  expanderWrite(img);
-  SPI.beginTransaction(SPISettings(4000000, MSBFIRST, SPI_MODE0));
-  SPI.transfer16(frame4822(ch, v));
-  SPI.endTransaction();
-  img |= (1u<<ExpanderBits::DAC1_CS) | (1u<<ExpanderBits::DAC2_CS);
-  expanderWrite(img);
+  expanderDacWrite(whichDac ? ExpanderBits::DAC2_CS : ExpanderBits::DAC1_CS, frame4822(ch, v));
 }
 
 // Calibration
@@ -112,9 +107,18 @@ static Voice v1, v2, v3, v4;
 static inline float midiNote_to_volts(int note){ return (note-36)/12.0f; }
 static inline void updatePitch(Voice& v){ float base=midiNote_to_volts(v.note<0?36:v.note); v.pitchHeldV = base + v.bend/12.0f + v.calib; }
 
-// Dirty flags
-static volatile bool dirtyPitch1=true, dirtyPitch2=true, dirtyMod1=true, dirtyMod2=true;
-static volatile bool dirtyPitch3=true, dirtyPitch4=true, dirtyMod3=true, dirtyMod4=true;
+// Dirty flags (pitch outputs are written by the glide engine, see glide.cpp)
+static volatile bool dirtyMod1=true, dirtyMod2=true, dirtyMod3=true, dirtyMod4=true;
+
+// Pitch DAC writer for the glide engine (loop or glide ISR)
+static void writePitchCode(uint8_t voice, uint16_t code){
+  switch(voice){
+    case 0: mcp4822_write(PIN_CS_DAC1, CH_B, code); break;
+    case 1: mcp4822_write(PIN_CS_DAC2, CH_B, code); break;
+    case 2: mcp4822_write_expander(1, EXP_PITCH3_CH_IDX, code); break;
+    case 3: mcp4822_write_expander(1, EXP_PITCH4_CH_IDX, code); break;
+  }
+}
 
 // Realtime outputs
 static volatile bool gate1=false, gate2=false, clk=false, rst=false;
@@ -131,7 +135,17 @@ static volatile uint8_t lastMidiCh=0, lastMidiNote=0, lastMidiVel=0; static vola
 
 // Button/OLED
 static uint32_t btnDownAt=0; static bool btnPrev=HIGH; const uint16_t LONG_MS=600; static uint32_t lastBeat=0;
-static uint32_t lastOledPaintMs=0; const uint32_t OLED_FPS_MS=80; static inline void drawRow(uint8_t row,const char* s){ oled.setCursor(0,row*8); oled.print(s); }
+static uint32_t lastOledPaintMs=0; const uint32_t OLED_FPS_MS=80;
+// Row cache: rows are built every OLED_FPS_MS, but only changed ones are
+// redrawn (one per loop pass) and the pager flushes only changed pages.
+static char oledRowCache[4][22] = {"","","",""};  // 21 chars per row + null
+static bool oledRowDirty[4] = {true, true, true, true};
+static void drawRow(uint8_t row, const char* s){
+  if (strncmp(oledRowCache[row], s, sizeof(oledRowCache[row])-1) == 0) return;
+  strncpy(oledRowCache[row], s, sizeof(oledRowCache[row])-1);
+  oledRowCache[row][sizeof(oledRowCache[row])-1] = '\0';
+  oledRowDirty[row] = true;
+}
 static char lineBuf[64];
 static uint8_t gOledPage = 0; // 0 = CH1-2, 1 = CH3-4
 
@@ -161,7 +175,7 @@ static void diag_render() {
   snprintf(lineBuf,sizeof(lineBuf),"M1:%4u P1:%4u", gDiagCodes[0], gDiagCodes[1]); oled.setCursor(0,8); oled.print(lineBuf);
   snprintf(lineBuf,sizeof(lineBuf),"M2:%4u P2:%4u", gDiagCodes[2], gDiagCodes[3]); oled.setCursor(0,16); oled.print(lineBuf);
   snprintf(lineBuf,sizeof(lineBuf),"M3:%4u M4:%4u", gDiagCodes[4], gDiagCodes[6]); oled.setCursor(0,24); oled.print(lineBuf);
-  oled.display();
+  oledPager.poll();
 }
 
 static void diag_tick() {
@@ -189,10 +203,11 @@ static void diag_tick() {
 void onNoteOn(byte ch, byte note, byte vel){
   lastMidiCh=ch; lastMidiNote=note; lastMidiVel=vel; lastMidiMs=millis();
   if(!vel){ onNoteOff(ch,note,0); return; }
-  if(ch==1){ v1.note=note; v1.modV=5.0f*(vel/127.0f); updatePitch(v1); gate1=true; dirtyMod1=true; dirtyPitch1=true; }
-  else if(ch==2){ v2.note=note; v2.modV=5.0f*(vel/127.0f); updatePitch(v2); gate2=true; dirtyMod2=true; dirtyPitch2=true; }
-  else if(ch==3){ v3.note=note; v3.modV=5.0f*(vel/127.0f); updatePitch(v3); gate3=true; dirtyMod3=true; dirtyPitch3=true; }
-  else if(ch==4){ v4.note=note; v4.modV=5.0f*(vel/127.0f); updatePitch(v4); gate4=true; dirtyMod4=true; dirtyPitch4=true; }
+  // legato = previous note on the channel still held (for legato-only glide)
+  if(ch==1){ bool lg=v1.note>=0; v1.note=note; v1.modV=5.0f*(vel/127.0f); updatePitch(v1); gate1=true; dirtyMod1=true; glideNote(0, v1.pitchHeldV, lg); }
+  else if(ch==2){ bool lg=v2.note>=0; v2.note=note; v2.modV=5.0f*(vel/127.0f); updatePitch(v2); gate2=true; dirtyMod2=true; glideNote(1, v2.pitchHeldV, lg); }
+  else if(ch==3){ bool lg=v3.note>=0; v3.note=note; v3.modV=5.0f*(vel/127.0f); updatePitch(v3); gate3=true; dirtyMod3=true; glideNote(2, v3.pitchHeldV, lg); }
+  else if(ch==4){ bool lg=v4.note>=0; v4.note=note; v4.modV=5.0f*(vel/127.0f); updatePitch(v4); gate4=true; dirtyMod4=true; glideNote(3, v4.pitchHeldV, lg); }
   else if(ch==10){
     int idx=(int)note-(int)DRUM_BASE_NOTE;
     if(idx>=0 && idx<(int)DRUM_COUNT){
@@ -204,19 +219,36 @@ void onNoteOn(byte ch, byte note, byte vel){
 }
 void onNoteOff(byte ch, byte note, byte){
   lastMidiCh=ch; lastMidiNote=note; lastMidiVel=0; lastMidiMs=millis();
-  if(ch==1 && v1.note==note){ gate1=false; v1.note=-1; dirtyPitch1=true; }
-  else if(ch==2 && v2.note==note){ gate2=false; v2.note=-1; dirtyPitch2=true; }
-  else if(ch==3 && v3.note==note){ gate3=false; v3.note=-1; dirtyPitch3=true; }
-  else if(ch==4 && v4.note==note){ gate4=false; v4.note=-1; dirtyPitch4=true; }
+  // Pitch holds after release (a running glide finishes)
+  if(ch==1 && v1.note==note){ gate1=false; v1.note=-1; }
+  else if(ch==2 && v2.note==note){ gate2=false; v2.note=-1; }
+  else if(ch==3 && v3.note==note){ gate3=false; v3.note=-1; }
+  else if(ch==4 && v4.note==note){ gate4=false; v4.note=-1; }
 }
 void onPitchBend(byte ch, int value){
   float semis=2.0f*(float)(value-8192)/8192.0f;
-  if(ch==1){ v1.bend=semis; if(v1.note>=0){ updatePitch(v1); dirtyPitch1=true; } }
-  else if(ch==2){ v2.bend=semis; if(v2.note>=0){ updatePitch(v2); dirtyPitch2=true; } }
-  else if(ch==3){ v3.bend=semis; if(v3.note>=0){ updatePitch(v3); dirtyPitch3=true; } }
-  else if(ch==4){ v4.bend=semis; if(v4.note>=0){ updatePitch(v4); dirtyPitch4=true; } }
+  if(ch==1){ v1.bend=semis; if(v1.note>=0){ updatePitch(v1); glideShift(0, v1.pitchHeldV); } }
+  else if(ch==2){ v2.bend=semis; if(v2.note>=0){ updatePitch(v2); glideShift(1, v2.pitchHeldV); } }
+  else if(ch==3){ v3.bend=semis; if(v3.note>=0){ updatePitch(v3); glideShift(2, v3.pitchHeldV); } }
+  else if(ch==4){ v4.bend=semis; if(v4.note>=0){ updatePitch(v4); glideShift(3, v4.pitchHeldV); } }
+}
+// Portamento per channel 1-4: CC 5 time, CC 65 on/off, CC 85 shape,
+// CC 86 time law, CC 87 legato-only
+static uint16_t glideTimeCC[GLIDE_VOICES] = {0,0,0,0};
+static bool glideOn[GLIDE_VOICES] = {false,false,false,false};
+void onControlChange(byte ch, byte cc, byte val){
+  if(ch<1 || ch>GLIDE_VOICES) return;
+  uint8_t v=ch-1; GlideConfig& g=glideConfig(v);
+  switch(cc){
+    case 5:  glideTimeCC[v]=(uint16_t)((uint32_t)val*val*2000u/(127u*127u)); break;  // 0-2 s, squared for fine short glides
+    case 65: glideOn[v]=(val>=64); break;
+    case 85: g.shape=(val>=64)?GLIDE_EXP:GLIDE_LINEAR; break;
+    case 86: g.law=(val>=64)?GLIDE_CONST_RATE:GLIDE_CONST_TIME; break;
+    case 87: g.legatoOnly=(val>=64); break;
+    default: return;
+  }
+  g.timeMs = glideOn[v] ? glideTimeCC[v] : 0;
 }
-void onControlChange(byte, byte, byte){ }
 
 // MIDI clock
 static volatile uint32_t midiTickCount=0; static const uint8_t PPQN=24, BEAT_DIV=24;
@@ -243,6 +275,8 @@ void setup(){
   mcp4822_write(PIN_CS_DAC1, CH_B, pitchVolt_to_code(0.0f));
   mcp4822_write(PIN_CS_DAC2, CH_A, modVolt_to_code(0.0f));
   mcp4822_write(PIN_CS_DAC2, CH_B, pitchVolt_to_code(0.0f));
+  glideBegin(writePitchCode);
+  for(uint8_t i=0;i<GLIDE_VOICES;i++) glideNote(i, 0.0f, false);
   AudioMemory(16);
   sgtl5000.enable();
   sgtl5000.inputSelect(AUDIO_INPUT_LINEIN);
@@ -253,6 +287,7 @@ void setup(){
   Wire.begin();
   if(oled.begin(SSD1306_SWITCHCAPVCC, 0x3C)){
     oled.clearDisplay(); oled.setTextSize(1); oled.setTextColor(SSD1306_WHITE); oled.setCursor(0,0); oled.display();
+    oledPager.begin(Wire, 400000);
   }
   analogReadResolution(12);
   // Boot-hold diagnostics: hold BTN during boot
@@ -297,13 +332,9 @@ void loop(){
   }
   GATE_WRITE(PIN_CLOCK, clk); GATE_WRITE(PIN_RESET, rst); GATE_WRITE(PIN_GATE1, gate1); GATE_WRITE(PIN_GATE2, gate2);
   if(dirtyMod1){ mcp4822_write(PIN_CS_DAC1, CH_A, modVolt_to_code_ch(0, v1.modV)); dirtyMod1=false; }
-  if(dirtyPitch1){ mcp4822_write(PIN_CS_DAC1, CH_B, pitchVolt_to_code_ch(0, v1.pitchHeldV)); dirtyPitch1=false; }
   if(dirtyMod2){ mcp4822_write(PIN_CS_DAC2, CH_A, modVolt_to_code_ch(1, v2.modV)); dirtyMod2=false; }
-  if(dirtyPitch2){ mcp4822_write(PIN_CS_DAC2, CH_B, pitchVolt_to_code_ch(1, v2.pitchHeldV)); dirtyPitch2=false; }
   if(dirtyMod3){ mcp4822_write_expander(0, EXP_MOD3_CH_IDX, modVolt_to_code_ch(2, v3.modV)); dirtyMod3=false; }
   if(dirtyMod4){ mcp4822_write_expander(0, EXP_MOD4_CH_IDX, modVolt_to_code_ch(3, v4.modV)); dirtyMod4=false; }
-  if(dirtyPitch3){ mcp4822_write_expander(1, EXP_PITCH3_CH_IDX, pitchVolt_to_code_ch(2, v3.pitchHeldV)); dirtyPitch3=false; }
-  if(dirtyPitch4){ mcp4822_write_expander(1, EXP_PITCH4_CH_IDX, pitchVolt_to_code_ch(3, v4.pitchHeldV)); dirtyPitch4=false; }
   if (now - lastBeat >= 1000) { lastBeat = now; digitalToggle(LED_BUILTIN); }
   // Combined expander image update: gates + drums, keep CS high
   {
@@ -345,7 +376,6 @@ void loop(){
     float vM3 = teensy_move_calib::MOD_M[2]*cM3 + teensy_move_calib::MOD_C[2];
     float vM4 = teensy_move_calib::MOD_M[3]*cM4 + teensy_move_calib::MOD_C[3];
     
-    oled.clearDisplay();
     if(gOledPage == 0) {
       snprintf(lineBuf,sizeof(lineBuf),"CH1-2 CLK:%c G1:%c G2:%c", clk?'#':'-', gate1?'#':'-', gate2?'#':'-'); drawRow(0,lineBuf);
       snprintf(lineBuf,sizeof(lineBuf),"P1:%+.2fV  P2:%+.2fV", vP1, vP2); drawRow(1,lineBuf);
@@ -358,7 +388,15 @@ void loop(){
     // Row 3: MIDI or drums
     if (now - lastMidiMs <= 1000) { snprintf(lineBuf,sizeof(lineBuf),"MIDI ch:%2u note:%3u vel:%3u", lastMidiCh,lastMidiNote,lastMidiVel); drawRow(3,lineBuf); }
     else { char d1=drumTrig[0]?'#':'-',d2=drumTrig[1]?'#':'-',d3=drumTrig[2]?'#':'-',d4=drumTrig[3]?'#':'-'; snprintf(lineBuf,sizeof(lineBuf),"Drums: D1:%c D2:%c D3:%c D4:%c",d1,d2,d3,d4); drawRow(3,lineBuf);}
-    oled.display(); lastOledPaintMs=now;
+    lastOledPaintMs=now;
+  }
+  for (uint8_t r = 0; r < 4; r++) {
+    if (!oledRowDirty[r]) continue;
+    oled.fillRect(0, r * 8, OLED_W, 8, SSD1306_BLACK);
+    oled.setCursor(0, r * 8); oled.print(oledRowCache[r]);
+    oledRowDirty[r] = false;
+    break;
   }
+  oledPager.poll();
 }
 
@@ -7,7 +7,19 @@ static uint8_t g_latchPin = 255;
 //   - Q HIGH -> jack LOW
 //   - Q LOW  -> jack HIGH
 // The main loop updates these bits continuously; this just defines a safe power-on image.
-static uint8_t g_image = 0xFF; // Q HIGH (DAC CS inactive; others depend on downstream inversion)
+static volatile uint8_t g_image = 0xFF; // Q HIGH (DAC CS inactive; others depend on downstream inversion)
+
+static const SPISettings kExpanderSpi(4000000, MSBFIRST, SPI_MODE0);
+
+// Shift + latch; caller holds the SPI transaction
+static inline void shiftLatch(uint8_t image){
+  SPI.transfer(image);
+  // Latch rising edge
+  digitalWriteFast(g_latchPin, HIGH);
+  // short pulse for reliability
+  delayMicroseconds(1);
+  digitalWriteFast(g_latchPin, LOW);
+}
 
 void expanderInit(uint8_t latchPin){
   g_latchPin = latchPin;
@@ -18,15 +30,21 @@ void expanderInit(uint8_t latchPin){
 }
 
 void expanderWrite(uint8_t image){
+  SPI.beginTransaction(kExpanderSpi);
   g_image = image;
-  SPI.beginTransaction(SPISettings(4000000, MSBFIRST, SPI_MODE0));
-  SPI.transfer(g_image);
+  shiftLatch(image);
+  SPI.endTransaction();
+}
+
+void expanderDacWrite(uint8_t csBit, uint16_t frame){
+  const uint8_t csMask = (1u<<ExpanderBits::DAC1_CS) | (1u<<ExpanderBits::DAC2_CS);
+  SPI.beginTransaction(kExpanderSpi);
+  uint8_t idle = g_image | csMask;
+  shiftLatch(idle & ~(1u<<csBit));
+  SPI.transfer16(frame);
+  shiftLatch(idle);
+  g_image = idle;
   SPI.endTransaction();
-  // Latch rising edge
-  digitalWrite(g_latchPin, HIGH);
-  // short pulse for reliability
-  delayMicroseconds(1);
-  digitalWrite(g_latchPin, LOW);
 }
 
 uint8_t expanderImage(){ return g_image; }
@@ -17,3 +17,8 @@ namespace ExpanderBits {
 void expanderInit(uint8_t latchPin);
 void expanderWrite(uint8_t image);
 uint8_t expanderImage();
+
+// Expander-CS DAC write as a single SPI transaction: assert CS bit, 16-bit
+// frame, deassert. With SPI.usingInterrupt() registered for the glide timer
+// (see glide.cpp) a timer ISR can never land in the middle of it.
+void expanderDacWrite(uint8_t csBit, uint16_t frame);